@@ -61,7 +61,7 @@ extern unsigned int Cpu_Load;
 #define configTICK_RATE_HZ			( ( TickType_t ) 1000 )
 #define configMAX_PRIORITIES		( 4 )
 #define configMINIMAL_STACK_SIZE	( ( unsigned short ) 90 )
-#define configTOTAL_HEAP_SIZE		( ( size_t ) 13 * 1024 )
+#define configTOTAL_HEAP_SIZE		( ( size_t ) 256 )	/* E.C. : every kernel object is statically allocated */
 #define configMAX_TASK_NAME_LEN		( 8 )
 #define configUSE_TRACE_FACILITY	1
 #define configUSE_16_BIT_TICKS		0
@@ -70,6 +70,78 @@ extern unsigned int Cpu_Load;
 //////////////////////////****************************/////////////////////
 #define configUSE_EDF_SCHEDULER   1
 
+/* E.C. : kernel variant, see edf.h.  The Keil project the demo is built with
+ * is not part of this tree, so its build targets are not either.  To compare
+ * the variants, give it one target per variant and one benchmark target,
+ * each with these defines under C/C++, Preprocessor Symbols:
+ *	EDF_Complete	configEDF_VARIANT=edfVARIANT_COMPLETE
+ *	EDF_Basic		configEDF_VARIANT=edfVARIANT_BASIC
+ *	EDF_Benchmark	configEDF_VARIANT=edfVARIANT_COMPLETE mainBENCHMARK=1
+ * and build EDF_Benchmark again with edfVARIANT_BASIC for the other side. */
+/* #define configEDF_VARIANT				edfVARIANT_COMPLETE */
+
+/* E.C. : the benchmark in main.c leaves the idle task out of the task load. */
+#define INCLUDE_xTaskGetIdleTaskHandle		1
+
+/* E.C. : 1 to schedule only the tasks of configEDF_BAND_PRIORITY by EDF, above
+ * and below it the priorities are fixed, see edf.h.  The demo tasks are all
+ * created at priority 1. */
+#define configUSE_EDF_BAND					0
+#define configEDF_BAND_PRIORITY				1
+
+/* E.C. : job level statistics, time stamped with timer 1 (~60 counts per ms) */
+#define configUSE_EDF_JOB_STATS				1
+#define configEDF_JOB_STATS_BUCKETS			12
+#define configEDF_TIMESTAMP()				( ( uint32_t ) T1TC )
+
+/* E.C. : integer only run time accounting, Cpu_Load is refreshed once per window */
+#define configUSE_EDF_UTILIZATION			1
+#define configEDF_UTILIZATION_WINDOW		( ( TickType_t ) 100 )	/* one hyperperiod */
+#define traceEDF_UTILIZATION_WINDOW( ulCpuLoad )	Cpu_Load = ( ulCpuLoad ) / 10
+
+/* E.C. : shed the least valuable jobs, see the value column of taskSet.h, when
+ * the ready jobs cannot all meet their deadlines */
+#define configUSE_EDF_OVERLOAD				1
+
+/* E.C. : PT and LS2 are firm, see the skip_m and skip_k columns of taskSet.h,
+ * a job of theirs that cannot make its deadline is skipped */
+#define configUSE_EDF_FIRM					1
+
+/* E.C. : EDF-VD, the tasks with a wcet_hi in taskSet.h are of HI criticality */
+#define configUSE_EDF_MIXED_CRITICALITY		1
+
+/* E.C. : stretch the periods of the soft tasks towards period_max of
+ * taskSet.h rather than miss deadlines */
+#define configUSE_EDF_ELASTIC				1
+
+/* E.C. : the demo runs a single mode, see xTaskEDFModeChange() in edf.h */
+#define configUSE_EDF_MODES					0
+
+/* E.C. : each time LS2 is dispatched it runs for a non-preemptive region of
+ * up to 3 ticks, see the npr column of taskSet.h.  Its 12 tick jobs are still
+ * preempted, but not more often than every 3 ticks */
+#define configUSE_EDF_LIMITED_PREEMPTION	1
+
+/* E.C. : PT and LS2 are only preempted by the tasks of shorter deadline than
+ * their threshold column in taskSet.h */
+#define configUSE_EDF_PREEMPTION_THRESHOLD	1
+
+/* E.C. : every task of the set is hard, there is no soft task to run in the
+ * slack */
+#define configUSE_EDF_SLACK_STEALING		0
+
+/* E.C. : the button tasks are sporadic with their own deadlines, none is a
+ * bandwidth server */
+#define configUSE_EDF_TBS				0
+
+/* E.C. : the board is mains powered and the demo measures its timing at the
+ * full clock */
+#define configUSE_EDF_DVS				0
+
+/* E.C. : tasks, idle task and queue live in buffers supplied by main.c */
+#define configSUPPORT_STATIC_ALLOCATION		1
+#define configSUPPORT_DYNAMIC_ALLOCATION	0
+
 #define configQUEUE_REGISTRY_SIZE 0
 /* Co-routine definitions. */
 #define configUSE_CO_ROUTINES 		0
@@ -162,7 +234,6 @@ to exclude the API function. */
 																						CLR_P0_PIN(PIN7);\
 																						}  						\
 										 System_Time = T1TC;\
-										 Cpu_Load = (Button_1_Total + Button_2_Total + Periodic_Transmitter_Total + Uart_Receiver_Total + Load_1_total + Load_2_total ) /(float) System_Time * 100 ;\
 										 
 										 
 #endif /* FREERTOS_CONFIG_H */
\ No newline at end of file
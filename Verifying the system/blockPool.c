@@ -0,0 +1,100 @@
+/*
+ * E.C. : Fixed size block pool and pointer channel, see blockPool.h.
+ */
+
+/* Scheduler includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "queue.h"
+
+#include "blockPool.h"
+
+/*-----------------------------------------------------------*/
+
+void vBlockPoolInit( BlockPool_t * pxPool, void ** ppvStorage, size_t xSize, UBaseType_t uxCount )
+{
+	size_t xWords = blockPOOL_WORDS( xSize );
+	UBaseType_t uxBlock;
+
+	configASSERT( uxCount > 0 );
+
+	/* Link every block to the one after it, the last one ends the list. */
+	for( uxBlock = 0; uxBlock < ( uxCount - 1 ); uxBlock++ )
+	{
+		ppvStorage[ uxBlock * xWords ] = &ppvStorage[ ( uxBlock + 1 ) * xWords ];
+	}
+	ppvStorage[ uxBlock * xWords ] = NULL;
+
+	taskENTER_CRITICAL();
+	{
+		pxPool->pvFree = ppvStorage;
+		pxPool->uxFree = uxCount;
+		pxPool->uxMinFree = uxCount;
+	}
+	taskEXIT_CRITICAL();
+}
+/*-----------------------------------------------------------*/
+
+void * pvBlockPoolAlloc( BlockPool_t * pxPool )
+{
+	void * pvBlock;
+
+	taskENTER_CRITICAL();
+	{
+		pvBlock = pxPool->pvFree;
+
+		if( pvBlock != NULL )
+		{
+			pxPool->pvFree = *( ( void ** ) pvBlock );
+			pxPool->uxFree--;
+
+			if( pxPool->uxFree < pxPool->uxMinFree )
+			{
+				pxPool->uxMinFree = pxPool->uxFree;
+			}
+		}
+	}
+	taskEXIT_CRITICAL();
+
+	return pvBlock;
+}
+/*-----------------------------------------------------------*/
+
+void vBlockPoolFree( BlockPool_t * pxPool, void * pvBlock )
+{
+	configASSERT( pvBlock != NULL );
+
+	taskENTER_CRITICAL();
+	{
+		*( ( void ** ) pvBlock ) = pxPool->pvFree;
+		pxPool->pvFree = pvBlock;
+		pxPool->uxFree++;
+	}
+	taskEXIT_CRITICAL();
+}
+/*-----------------------------------------------------------*/
+
+void vBlockChannelInit( BlockChannel_t * pxChannel, void ** ppvStorage, UBaseType_t uxLength )
+{
+	pxChannel->xQueue = xQueueCreateStatic( uxLength, sizeof( void * ), ( uint8_t * ) ppvStorage, &( pxChannel->xQueueBuffer ) );
+	configASSERT( pxChannel->xQueue != NULL );
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xBlockChannelSend( BlockChannel_t * pxChannel, void * pvBlock )
+{
+	return xQueueSend( pxChannel->xQueue, &pvBlock, ( TickType_t ) 0 );
+}
+/*-----------------------------------------------------------*/
+
+void * pvBlockChannelReceive( BlockChannel_t * pxChannel, TickType_t xTicksToWait )
+{
+	void * pvBlock;
+
+	if( xQueueReceive( pxChannel->xQueue, &pvBlock, xTicksToWait ) != pdPASS )
+	{
+		pvBlock = NULL;
+	}
+
+	return pvBlock;
+}
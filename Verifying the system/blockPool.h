@@ -0,0 +1,65 @@
+/*
+ * E.C. : Fixed size block pool and a channel that passes blocks by pointer.
+ *
+ * A producer takes a block from the pool, fills it in place and sends the
+ * pointer down a channel.  The consumer owns the block from the moment it
+ * receives it until it frees it back to the pool.  Only the pointer is ever
+ * copied, so the cost of a message does not depend on its size.
+ *
+ * Allocation and release pop and push a free list, in constant time and
+ * under a critical section of a few instructions, so they can be counted in
+ * the WCET of a job like any other constant cost.
+ */
+
+#ifndef BLOCK_POOL_H
+#define BLOCK_POOL_H
+
+#include "FreeRTOS.h"
+#include "queue.h"
+
+/* Declare the storage of a pool of uxCount blocks of xSize bytes.  Each
+ * block is rounded up to a whole number of pointers, which also gives it the
+ * alignment of a pointer. */
+#define blockPOOL_WORDS( xSize )						( ( ( xSize ) + sizeof( void * ) - 1 ) / sizeof( void * ) )
+#define blockPOOL_STORAGE( xName, xSize, uxCount )		void * xName[ blockPOOL_WORDS( xSize ) * ( uxCount ) ]
+
+typedef struct
+{
+	void * pvFree;				/* First free block, each free block starts with a pointer to the next. */
+	UBaseType_t uxFree;			/* Number of free blocks. */
+	UBaseType_t uxMinFree;		/* Low water mark of uxFree, to size the pool. */
+} BlockPool_t;
+
+/* Thread the free list through the storage declared with blockPOOL_STORAGE(),
+ * with the same xSize and uxCount. */
+void vBlockPoolInit( BlockPool_t * pxPool, void ** ppvStorage, size_t xSize, UBaseType_t uxCount );
+
+/* Take a block, or NULL if the pool is empty.  Never blocks. */
+void * pvBlockPoolAlloc( BlockPool_t * pxPool );
+
+/* Give back a block obtained from the same pool. */
+void vBlockPoolFree( BlockPool_t * pxPool, void * pvBlock );
+
+/* A channel is a kernel queue of pointers: sending and receiving copy one
+ * pointer, and the receiver can block on it like on any queue. */
+typedef struct
+{
+	QueueHandle_t xQueue;
+	StaticQueue_t xQueueBuffer;
+} BlockChannel_t;
+
+/* Declare the storage of a channel that holds up to uxLength blocks. */
+#define blockCHANNEL_STORAGE( xName, uxLength )			void * xName[ uxLength ]
+
+void vBlockChannelInit( BlockChannel_t * pxChannel, void ** ppvStorage, UBaseType_t uxLength );
+
+/* Pass pvBlock to the receiver.  Returns pdPASS, or errQUEUE_FULL without
+ * waiting if the channel is full, in which case the sender still owns the
+ * block. */
+BaseType_t xBlockChannelSend( BlockChannel_t * pxChannel, void * pvBlock );
+
+/* Receive a block, waiting up to xTicksToWait for one.  Returns NULL if none
+ * arrived. */
+void * pvBlockChannelReceive( BlockChannel_t * pxChannel, TickType_t xTicksToWait );
+
+#endif /* BLOCK_POOL_H */
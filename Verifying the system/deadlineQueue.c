@@ -0,0 +1,165 @@
+/*
+ * E.C. : Message queue delivered in deadline order, see deadlineQueue.h.
+ */
+
+/* Scheduler includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+
+#include "deadlineQueue.h"
+
+/*-----------------------------------------------------------*/
+
+/* Deadlines are compared through their difference, so the order stays right
+ * across a wrap of the tick count. */
+#define deadlineBEFORE( xA, xB )	( ( BaseType_t ) ( ( xA ) - ( xB ) ) < 0 )
+
+static DeadlineMessage_t prvPop( DeadlineQueue_t * pxQueue, uint8_t ucType );
+
+/*-----------------------------------------------------------*/
+
+void vDeadlineQueueInit( DeadlineQueue_t * pxQueue )
+{
+	UBaseType_t uxType;
+
+	taskENTER_CRITICAL();
+	{
+		for( uxType = 0; uxType < deadlineQUEUE_TYPES; uxType++ )
+		{
+			pxQueue->uxCount[ uxType ] = 0;
+		}
+		pxQueue->ulRefused = 0;
+	}
+	taskEXIT_CRITICAL();
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xDeadlineQueueSend( DeadlineQueue_t * pxQueue, uint8_t ucType, TickType_t xDeadline, uint32_t ulData )
+{
+	DeadlineMessage_t * pxHeap;
+	UBaseType_t uxChild, uxParent;
+	BaseType_t xReturn;
+
+	configASSERT( ucType < deadlineQUEUE_TYPES );
+
+	taskENTER_CRITICAL();
+	{
+		pxHeap = pxQueue->xHeap[ ucType ];
+		uxChild = pxQueue->uxCount[ ucType ];
+
+		if( uxChild < deadlineQUEUE_DEPTH )
+		{
+			/* Sift the new message up from the end of the heap. */
+			while( uxChild > 0 )
+			{
+				uxParent = ( uxChild - 1 ) / 2;
+				if( !deadlineBEFORE( xDeadline, pxHeap[ uxParent ].xDeadline ) )
+				{
+					break;
+				}
+				pxHeap[ uxChild ] = pxHeap[ uxParent ];
+				uxChild = uxParent;
+			}
+
+			pxHeap[ uxChild ].xDeadline = xDeadline;
+			pxHeap[ uxChild ].ucType = ucType;
+			pxHeap[ uxChild ].ulData = ulData;
+			pxQueue->uxCount[ ucType ]++;
+			xReturn = pdPASS;
+		}
+		else
+		{
+			pxQueue->ulRefused++;
+			xReturn = errQUEUE_FULL;
+		}
+	}
+	taskEXIT_CRITICAL();
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xDeadlineQueueReceive( DeadlineQueue_t * pxQueue, DeadlineMessage_t * pxMessage )
+{
+	UBaseType_t uxType, uxBest = deadlineQUEUE_TYPES;
+	BaseType_t xReturn = pdFAIL;
+
+	taskENTER_CRITICAL();
+	{
+		/* The most urgent message is at the root of one of the heaps. */
+		for( uxType = 0; uxType < deadlineQUEUE_TYPES; uxType++ )
+		{
+			if( ( pxQueue->uxCount[ uxType ] > 0 ) &&
+				( ( uxBest == deadlineQUEUE_TYPES ) ||
+				  deadlineBEFORE( pxQueue->xHeap[ uxType ][ 0 ].xDeadline, pxQueue->xHeap[ uxBest ][ 0 ].xDeadline ) ) )
+			{
+				uxBest = uxType;
+			}
+		}
+
+		if( uxBest != deadlineQUEUE_TYPES )
+		{
+			*pxMessage = prvPop( pxQueue, ( uint8_t ) uxBest );
+			xReturn = pdPASS;
+		}
+	}
+	taskEXIT_CRITICAL();
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xDeadlineQueueReceiveType( DeadlineQueue_t * pxQueue, uint8_t ucType, DeadlineMessage_t * pxMessage )
+{
+	BaseType_t xReturn = pdFAIL;
+
+	configASSERT( ucType < deadlineQUEUE_TYPES );
+
+	taskENTER_CRITICAL();
+	{
+		if( pxQueue->uxCount[ ucType ] > 0 )
+		{
+			*pxMessage = prvPop( pxQueue, ucType );
+			xReturn = pdPASS;
+		}
+	}
+	taskEXIT_CRITICAL();
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+/* Remove the root of a non empty heap.  Called in a critical section. */
+static DeadlineMessage_t prvPop( DeadlineQueue_t * pxQueue, uint8_t ucType )
+{
+	DeadlineMessage_t * pxHeap = pxQueue->xHeap[ ucType ];
+	DeadlineMessage_t xRoot = pxHeap[ 0 ];
+	DeadlineMessage_t xLast;
+	UBaseType_t uxCount, uxParent = 0, uxChild;
+
+	uxCount = --( pxQueue->uxCount[ ucType ] );
+	xLast = pxHeap[ uxCount ];
+
+	/* Sift the last message down from the root. */
+	for( ;; )
+	{
+		uxChild = ( 2 * uxParent ) + 1;
+		if( uxChild >= uxCount )
+		{
+			break;
+		}
+		if( ( uxChild + 1 < uxCount ) && deadlineBEFORE( pxHeap[ uxChild + 1 ].xDeadline, pxHeap[ uxChild ].xDeadline ) )
+		{
+			uxChild++;
+		}
+		if( !deadlineBEFORE( pxHeap[ uxChild ].xDeadline, xLast.xDeadline ) )
+		{
+			break;
+		}
+		pxHeap[ uxParent ] = pxHeap[ uxChild ];
+		uxParent = uxChild;
+	}
+	pxHeap[ uxParent ] = xLast;
+
+	return xRoot;
+}
@@ -0,0 +1,61 @@
+/*
+ * E.C. : Message queue delivered in deadline order.
+ *
+ * Every message carries a type tag and an absolute deadline in ticks.  Each
+ * type has its own binary min-heap ordered on the deadline, so a receiver can
+ * take the most urgent message of one type in O(log n), or the most urgent
+ * message of all in O(types + log n).  Senders never block: a message that
+ * does not fit is refused at once, so a hard deadline task never waits on a
+ * slow receiver.
+ *
+ * All the memory is in the DeadlineQueue_t, there is no allocation.  The
+ * functions take a short critical section and must not be called from an
+ * interrupt.
+ */
+
+#ifndef DEADLINE_QUEUE_H
+#define DEADLINE_QUEUE_H
+
+#include "FreeRTOS.h"
+
+/* Number of message types, tags run from 0 to deadlineQUEUE_TYPES - 1. */
+#ifndef deadlineQUEUE_TYPES
+	#define deadlineQUEUE_TYPES		4
+#endif
+
+/* Messages of one type the queue can hold. */
+#ifndef deadlineQUEUE_DEPTH
+	#define deadlineQUEUE_DEPTH		4
+#endif
+
+typedef struct
+{
+	TickType_t xDeadline;	/* Tick count by which the message should be handled. */
+	uint8_t ucType;			/* Type tag. */
+	uint32_t ulData;		/* Payload. */
+} DeadlineMessage_t;
+
+typedef struct
+{
+	DeadlineMessage_t xHeap[ deadlineQUEUE_TYPES ][ deadlineQUEUE_DEPTH ];
+	UBaseType_t uxCount[ deadlineQUEUE_TYPES ];
+	uint32_t ulRefused;		/* Messages refused because their type was full. */
+} DeadlineQueue_t;
+
+/* Empty the queue.  A DeadlineQueue_t with static storage duration starts
+ * empty already. */
+void vDeadlineQueueInit( DeadlineQueue_t * pxQueue );
+
+/* Queue a message.  Returns pdPASS, or errQUEUE_FULL without waiting when
+ * deadlineQUEUE_DEPTH messages of type ucType are already queued. */
+BaseType_t xDeadlineQueueSend( DeadlineQueue_t * pxQueue, uint8_t ucType, TickType_t xDeadline, uint32_t ulData );
+
+/* Take the message with the earliest deadline, whatever its type.  Returns
+ * pdPASS, or pdFAIL if the queue is empty. */
+BaseType_t xDeadlineQueueReceive( DeadlineQueue_t * pxQueue, DeadlineMessage_t * pxMessage );
+
+/* Take the message of type ucType with the earliest deadline.  Returns
+ * pdPASS, or pdFAIL if there is none. */
+BaseType_t xDeadlineQueueReceiveType( DeadlineQueue_t * pxQueue, uint8_t ucType, DeadlineMessage_t * pxMessage );
+
+#endif /* DEADLINE_QUEUE_H */
@@ -0,0 +1,1009 @@
+/*
+ * FreeRTOS Kernel V10.4.6
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+/* E.C. : API of the EDF extensions implemented in tasks.c. */
+
+#ifndef INC_EDF_H
+#define INC_EDF_H
+
+#ifndef INC_FREERTOS_H
+    #error "include FreeRTOS.h must appear in source files before include edf.h"
+#endif
+
+#include "task.h"
+
+/* The EDF scheduler is built into the single core kernel: one running task,
+ * one deadline ordered ready list.  Global EDF needs the SMP kernel, with a
+ * running task per core, which this tree does not have, so refuse to build
+ * for more than one core rather than schedule a single one. */
+#if ( defined( configNUM_CORES ) && ( configNUM_CORES > 1 ) ) || ( defined( configNUMBER_OF_CORES ) && ( configNUMBER_OF_CORES > 1 ) )
+    #error The EDF scheduler supports a single core only
+#endif
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+    extern "C" {
+#endif
+/* *INDENT-ON* */
+
+/*-----------------------------------------------------------
+* MACROS AND DEFINITIONS
+*----------------------------------------------------------*/
+
+/* The kernel variants the project has been through, one tasks.c for all of
+ * them.  configEDF_VARIANT selects the defaults of the options below, which
+ * can also be set one by one in FreeRTOSConfig.h.
+ *
+ * edfVARIANT_COMPLETE: the full EDF scheduler ("Verifying the system").
+ * edfVARIANT_BASIC: only the EDF ready list, the deadline of a task is set
+ * when it is created and never renewed ("Implement the required changes"). */
+#define edfVARIANT_COMPLETE    0
+#define edfVARIANT_BASIC       1
+
+#ifndef configEDF_VARIANT
+    #define configEDF_VARIANT    edfVARIANT_COMPLETE
+#endif
+
+#if ( configEDF_VARIANT == edfVARIANT_BASIC )
+    #define edfVARIANT_DEFAULT    0
+#else
+    #define edfVARIANT_DEFAULT    1
+#endif
+
+/* Give a task released by the tick the deadline of its new job. */
+#ifndef configEDF_RELEASE_DEADLINE
+    #define configEDF_RELEASE_DEADLINE    edfVARIANT_DEFAULT
+#endif
+
+/* Switch to a task released by the tick if its deadline is not later than
+ * the deadline of the running task. */
+#ifndef configEDF_RELEASE_PREEMPTION
+    #define configEDF_RELEASE_PREEMPTION    edfVARIANT_DEFAULT
+#endif
+
+/* Set configUSE_EDF_BAND to 1 in FreeRTOSConfig.h to schedule only the tasks
+ * of priority configEDF_BAND_PRIORITY by EDF.  Tasks of a higher priority, the
+ * timer daemon or driver tasks for example, preempt the band as they would
+ * under the fixed priority scheduler, and tasks of a lower priority only run
+ * when no task of the band is ready.  Left at 0 every task is scheduled by
+ * EDF and the priorities are ignored. */
+#ifndef configUSE_EDF_BAND
+    #define configUSE_EDF_BAND    0
+#endif
+
+#ifndef configEDF_BAND_PRIORITY
+    #define configEDF_BAND_PRIORITY    1
+#endif
+
+#if ( configUSE_EDF_BAND == 1 )
+    #if ( ( configEDF_BAND_PRIORITY < 1 ) || ( configEDF_BAND_PRIORITY >= configMAX_PRIORITIES ) )
+        #error configEDF_BAND_PRIORITY must be above the idle priority and below configMAX_PRIORITIES
+    #endif
+#endif
+
+/* Keep pushing the deadline of the idle task a period ahead, so it stays
+ * behind every other task in the ready list.  Not needed with an EDF band,
+ * the idle task is below it. */
+#ifndef configEDF_IDLE_DEADLINE_REFRESH
+    #if ( configUSE_EDF_BAND == 1 )
+        #define configEDF_IDLE_DEADLINE_REFRESH    0
+    #else
+        #define configEDF_IDLE_DEADLINE_REFRESH    edfVARIANT_DEFAULT
+    #endif
+#endif
+
+/* Set configUSE_EDF_JOB_STATS to 1 in FreeRTOSConfig.h to have the kernel
+ * record the release, start and completion of every job of a periodic task. */
+#ifndef configUSE_EDF_JOB_STATS
+    #define configUSE_EDF_JOB_STATS    0
+#endif
+
+/* Number of log2 buckets in the response time histogram of each task. */
+#ifndef configEDF_JOB_STATS_BUCKETS
+    #define configEDF_JOB_STATS_BUCKETS    8
+#endif
+
+/* Response times are shifted right by this many bits before being sorted into
+ * the histogram, so the first bucket can be made wider than one time unit. */
+#ifndef configEDF_JOB_STATS_BUCKET_SHIFT
+    #define configEDF_JOB_STATS_BUCKET_SHIFT    0
+#endif
+
+/* Set configUSE_EDF_UTILIZATION to 1 in FreeRTOSConfig.h to have the kernel
+ * accumulate the run time of every task and compute the utilization of each
+ * task, and of the CPU, over a sliding window. */
+#ifndef configUSE_EDF_UTILIZATION
+    #define configUSE_EDF_UTILIZATION    0
+#endif
+
+/* Length of the utilization window in ticks. */
+#ifndef configEDF_UTILIZATION_WINDOW
+    #define configEDF_UTILIZATION_WINDOW    ( ( TickType_t ) 1000 )
+#endif
+
+/* Called from the tick interrupt each time a utilization window closes, with
+ * the CPU load of that window in tenths of a percent. */
+#ifndef traceEDF_UTILIZATION_WINDOW
+    #define traceEDF_UTILIZATION_WINDOW( ulCpuLoad )
+#endif
+
+/* Set configUSE_EDF_OVERLOAD to 1 in FreeRTOSConfig.h to have the kernel shed
+ * jobs when the ready jobs can no longer all meet their deadlines.  Each tick
+ * that releases a job the ready list is walked in deadline order, adding up
+ * the budget left to every job.  If a job would complete after its deadline
+ * the least valuable job that has not started yet is skipped, see
+ * vTaskSetEDFValue(), and the walk is repeated until the ready jobs fit or
+ * none is left that can be shed.  Jobs without a budget add nothing to the
+ * demand. */
+#ifndef configUSE_EDF_OVERLOAD
+    #define configUSE_EDF_OVERLOAD    0
+#endif
+
+/* Set configUSE_EDF_FIRM to 1 in FreeRTOSConfig.h to have (m,k)-firm tasks,
+ * see vTaskSetEDFFirm(), which may skip m jobs in any k in a row.  When the
+ * overload check finds that a job of a firm task that has not started would
+ * complete after its deadline, the job is skipped, as long as the task can
+ * afford it, and the processor goes to the jobs that can still make theirs.
+ * A skipped job, or one that completes late, counts against the m.  A firm
+ * task that cannot afford another skip is not shed for its value either.
+ * Relies on configUSE_EDF_OVERLOAD. */
+#ifndef configUSE_EDF_FIRM
+    #define configUSE_EDF_FIRM    0
+#endif
+
+#if ( ( configUSE_EDF_FIRM == 1 ) && ( configUSE_EDF_OVERLOAD == 0 ) )
+    #error configUSE_EDF_FIRM needs configUSE_EDF_OVERLOAD
+#endif
+
+/* Called from the tick interrupt when the job of pxTCB is shed. */
+#ifndef traceEDF_JOB_SHED
+    #define traceEDF_JOB_SHED( pxTCB )
+#endif
+
+/* Set configUSE_EDF_MIXED_CRITICALITY to 1 in FreeRTOSConfig.h to schedule
+ * the task set by EDF-VD.  Tasks given a HI budget with
+ * vTaskSetEDFCriticality() are of HI criticality, the others of LO.  The
+ * system starts in LO mode, where HI tasks run to a virtual deadline earlier
+ * than their real one.  When a HI job runs past its LO budget, the budget set
+ * by vTaskSetEDFParameters(), the system switches to HI mode: the HI jobs
+ * get their real deadlines back and LO jobs are shed until the next time the
+ * idle task runs, which switches the system back to LO mode.  Budgets are
+ * counted in whole ticks, and shedding relies on configUSE_EDF_OVERLOAD. */
+#ifndef configUSE_EDF_MIXED_CRITICALITY
+    #define configUSE_EDF_MIXED_CRITICALITY    0
+#endif
+
+#if ( ( configUSE_EDF_MIXED_CRITICALITY == 1 ) && ( configUSE_EDF_OVERLOAD == 0 ) )
+    #error configUSE_EDF_MIXED_CRITICALITY needs configUSE_EDF_OVERLOAD
+#endif
+
+/* Criticality modes, as returned by xTaskGetEDFCriticalityMode(). */
+#define edfCRITICALITY_LO    ( ( BaseType_t ) 0 )
+#define edfCRITICALITY_HI    ( ( BaseType_t ) 1 )
+
+/* Called from the tick interrupt or the idle task each time the criticality
+ * mode changes, with the new mode. */
+#ifndef traceEDF_CRITICALITY_MODE
+    #define traceEDF_CRITICALITY_MODE( xMode )
+#endif
+
+/* Set configUSE_EDF_ELASTIC to 1 in FreeRTOSConfig.h to stretch the periods
+ * of periodic tasks instead of missing deadlines, the elastic task model.  A
+ * task registered with vTaskSetEDFElastic() accepts any period from the one it
+ * was created with up to a longest one.  xTaskEDFElasticAdapt() brings the
+ * utilization of the registered tasks down to a target, each elastic task
+ * giving up utilization in proportion to its elasticity.  A new period takes
+ * effect when the job in progress completes. */
+#ifndef configUSE_EDF_ELASTIC
+    #define configUSE_EDF_ELASTIC    0
+#endif
+
+/* Set configUSE_EDF_MODES to 1 in FreeRTOSConfig.h to switch between task sets
+ * with xTaskEDFModeChange().  A mode change stops the tasks of the old mode
+ * that do not run in the new one and releases those of the new mode that did
+ * not run in the old one.  It is applied the next time the idle task runs,
+ * when every job of the old mode has completed, so the old and the new task
+ * sets never overlap and each only has to be schedulable on its own.  The
+ * tasks of a mode must only block at the end of their jobs, in
+ * vTaskDelayUntil() or ulTaskSporadicWait().  Stopped tasks are suspended. */
+#ifndef configUSE_EDF_MODES
+    #define configUSE_EDF_MODES    0
+#endif
+
+#if ( ( configUSE_EDF_MODES == 1 ) && ( INCLUDE_vTaskSuspend == 0 ) )
+    #error configUSE_EDF_MODES needs INCLUDE_vTaskSuspend
+#endif
+
+/* Called from the idle task when a mode change is applied, or at once if it
+ * is requested before the scheduler starts. */
+#ifndef traceEDF_MODE_CHANGE
+    #define traceEDF_MODE_CHANGE( pxChange )
+#endif
+
+/* Set configUSE_EDF_LIMITED_PREEMPTION to 1 in FreeRTOSConfig.h to let tasks
+ * run in non-preemptive regions, see vTaskSetEDFNonPreemptive().  A release
+ * with an earlier deadline, from the tick or vTaskSporadicReleaseFromISR(),
+ * does not preempt a job that has run for less than the region length of its
+ * task since it was dispatched or since its last
+ * vTaskEDFPreemptionPoint().  The preemption is taken when the region ends.
+ * Regions are counted in whole ticks.  With configUSE_EDF_BAND a region only
+ * holds back the EDF band, a task of a higher priority still preempts it. */
+#ifndef configUSE_EDF_LIMITED_PREEMPTION
+    #define configUSE_EDF_LIMITED_PREEMPTION    0
+#endif
+
+/* Set configUSE_EDF_PREEMPTION_THRESHOLD to 1 in FreeRTOSConfig.h to give
+ * tasks preemption thresholds, see vTaskSetEDFThreshold().  The preemption
+ * level of a task is given by its relative deadline, the shorter the higher.
+ * A job released with an earlier deadline only preempts the running job if
+ * its relative deadline is also shorter than the threshold of the running
+ * task, otherwise it waits for the running job to complete or block.  A
+ * started job keeps its threshold while it is preempted: the shortest
+ * threshold of the ready jobs that have started is the system ceiling, and
+ * the dispatcher only runs a job ahead of them if its relative deadline is
+ * shorter than that. */
+#ifndef configUSE_EDF_PREEMPTION_THRESHOLD
+    #define configUSE_EDF_PREEMPTION_THRESHOLD    0
+#endif
+
+/* Set configUSE_EDF_SLACK_STEALING to 1 in FreeRTOSConfig.h to run soft
+ * tasks, see vTaskSetEDFSoft(), in the slack of the hard ones.  The kernel
+ * works out how long the hard jobs, those ready and those still to be
+ * released, can be put off without missing a deadline.  That is done in the
+ * tick after a job completes or is released sporadically, or once the
+ * deadline the slack was found at has passed, and only while a soft job is
+ * ready.  On the other ticks the slack is used up a tick at a time.  While
+ * there is slack the soft jobs run ahead of every hard job, otherwise behind
+ * the hard jobs that need the processor.  The hard tasks are the periodic and
+ * sporadic tasks with a budget, tasks without one are not counted, and they
+ * must only block at the end of their jobs.  Relies on configUSE_EDF_OVERLOAD
+ * for the time each job has run. */
+#ifndef configUSE_EDF_SLACK_STEALING
+    #define configUSE_EDF_SLACK_STEALING    0
+#endif
+
+#if ( ( configUSE_EDF_SLACK_STEALING == 1 ) && ( configUSE_EDF_OVERLOAD == 0 ) )
+    #error configUSE_EDF_SLACK_STEALING needs configUSE_EDF_OVERLOAD
+#endif
+
+/* Set configUSE_EDF_TBS to 1 in FreeRTOSConfig.h to serve aperiodic requests
+ * with a Total Bandwidth Server, see vTaskSetEDFServer().  A server is a
+ * sporadic task whose jobs get the deadline max( r, d ) + C / Us, for release
+ * r, deadline d of the last job, budget C and server bandwidth Us, instead of
+ * r + D.  The deadline takes the same constant time to work out as r + D and
+ * the job goes into the ready list like any other, so the server costs
+ * nothing in the tick.  Up + Us <= 1, for the utilization Up of the other
+ * tasks, keeps every deadline. */
+#ifndef configUSE_EDF_TBS
+    #define configUSE_EDF_TBS    0
+#endif
+
+/* Set configUSE_EDF_DVS to 1 in FreeRTOSConfig.h to run the processor at the
+ * lowest speed that still meets every deadline, by cycle-conserving EDF.
+ * Each task counts for its budget over its period from the release of a job,
+ * and for the work the job really did once it completes, until its next
+ * release.  The speed, the sum of these shares, is passed to
+ * configEDF_DVS_SET_SPEED() whenever it changes.  The work is sampled each
+ * tick at the speed then in use, and a completed job is charged one more
+ * tick of it for the part tick it ran last.  Tasks without a budget are not
+ * counted, so every task with real work to do needs one.  The budgets of
+ * configUSE_EDF_OVERLOAD, and of the options built on it, are compared with
+ * the ticks a job has run, not the work it has done, so at a lower speed a
+ * job would look done early.  This cannot be used with it. */
+#ifndef configUSE_EDF_DVS
+    #define configUSE_EDF_DVS    0
+#endif
+
+#if ( ( configUSE_EDF_DVS == 1 ) && ( configUSE_EDF_OVERLOAD == 1 ) )
+    #error configUSE_EDF_DVS cannot be used with configUSE_EDF_OVERLOAD
+#endif
+
+/* Sets the processor clock for ulSpeed, in parts per million of the full
+ * speed that the budgets were measured at.  The port rounds up to the
+ * nearest clock it has and must keep the tick rate.  Called from the tick
+ * and from vTaskSporadicReleaseFromISR(), so interrupts are masked. */
+#ifndef configEDF_DVS_SET_SPEED
+    #define configEDF_DVS_SET_SPEED( ulSpeed )
+#endif
+
+/* Called whenever the speed changes, before configEDF_DVS_SET_SPEED(). */
+#ifndef traceEDF_SPEED_CHANGE
+    #define traceEDF_SPEED_CHANGE( ulSpeed )
+#endif
+
+/* How far ahead the slack is looked for, in ticks.  Must be at least the
+ * hyperperiod of the hard tasks.  The work of each time the slack is worked
+ * out grows with the number of deadlines of the hard tasks in this window
+ * times the number of tasks. */
+#ifndef configEDF_SLACK_HORIZON
+    #define configEDF_SLACK_HORIZON    ( ( TickType_t ) 1000 )
+#endif
+
+/*
+ * Job statistics of a periodic task, as returned by vTaskGetJobStats().
+ *
+ * All times are in units of configEDF_TIMESTAMP().  A job is released when
+ * the kernel moves the task out of vTaskDelayUntil(), starts when it is first
+ * switched in after its release, and completes when it calls
+ * vTaskDelayUntil() again.
+ *
+ * Response time is completion - release, start latency is start - release.
+ * Finishing jitter is ulResponseMax - ulResponseMin and start jitter is
+ * ulStartLatencyMax - ulStartLatencyMin.
+ *
+ * ulResponseHistogram[ n ] counts the jobs whose response time, shifted right
+ * by configEDF_JOB_STATS_BUCKET_SHIFT, is in [ 2^n, 2^(n+1) ).  Bucket 0 also
+ * holds zero, the last bucket holds everything that does not fit.
+ */
+typedef struct xEDF_JOB_STATS
+{
+    uint32_t ulJobCount;         /*< Number of completed jobs. */
+    uint32_t ulResponseMin;      /*< Shortest release to completion time. */
+    uint32_t ulResponseMax;      /*< Longest release to completion time. */
+    uint32_t ulResponseMean;     /*< Mean release to completion time. */
+    uint32_t ulStartLatencyMin;  /*< Shortest release to first dispatch time. */
+    uint32_t ulStartLatencyMax;  /*< Longest release to first dispatch time. */
+    uint32_t ulStartLatencyMean; /*< Mean release to first dispatch time. */
+    uint32_t ulResponseHistogram[ configEDF_JOB_STATS_BUCKETS ];
+} EDFJobStats_t;
+
+/*
+ * Per task EDF information, as returned by vTaskGetEDFInfo() and
+ * uxTaskGetSystemStateEDF().  In the array filled in by the latter, entry n
+ * describes the same task as entry n of the TaskStatus_t array filled in by
+ * the same call.  Members that need a configuration option that is turned
+ * off read as zero.
+ */
+typedef struct xEDF_TASK_STATUS
+{
+    TaskHandle_t xHandle;          /*< The handle of the task to which the rest of the information in the structure relates. */
+    TickType_t xPeriod;            /*< Period in ticks, 0 if the task was not created with xTaskPeriodicCreate(). */
+    TickType_t xRelativeDeadline;  /*< Deadline of each job relative to its release, in ticks. */
+    TickType_t xAbsoluteDeadline;  /*< Deadline of the current job, or of the last one if the task is waiting for its next release. */
+    TickType_t xBudget;            /*< Declared worst case execution time in ticks, 0 if not set. */
+    uint32_t ulDeadlineMisses;     /*< Number of jobs that completed after their deadline. */
+    uint64_t ullRunTime;           /*< Total time the task has spent in the Running state, in units of configEDF_TIMESTAMP(). */
+    uint32_t ulUtilization;        /*< Share of the last completed utilization window the task spent running, in tenths of a percent. */
+    UBaseType_t uxValue;           /*< Value of the jobs of the task under overload, 0 if they are never shed. */
+    uint32_t ulJobsShed;           /*< Number of jobs shed under overload. */
+} EDFTaskStatus_t;
+
+/*
+ * A change from one mode to another, as passed to xTaskEDFModeChange().  The
+ * tables are filled in by the application once its tasks are created and are
+ * read by the kernel when the change is applied, so they must stay in scope.
+ * Declaring one per pair of modes the system switches between makes the cost
+ * of a change the number of tasks it stops and starts.
+ */
+typedef struct xEDF_MODE_CHANGE
+{
+    const TaskHandle_t * pxStop;   /*< Tasks of the old mode that do not run in the new one. */
+    UBaseType_t uxStop;            /*< Number of entries in pxStop. */
+    const TaskHandle_t * pxStart;  /*< Tasks of the new mode that did not run in the old one. */
+    UBaseType_t uxStart;           /*< Number of entries in pxStart. */
+} EDFModeChange_t;
+
+/*
+ * The TCB of a task scheduled by EDF carries members that StaticTask_t, which
+ * is defined in FreeRTOS.h, knows nothing about.  StaticEDFTask_t extends it
+ * with dummy members in the same order as the EDF members of the TCB, so a
+ * variable of this type is large enough to hold the TCB of a periodic task.
+ * As with StaticTask_t, its members must not be accessed by the application.
+ */
+typedef struct xSTATIC_EDF_TASK
+{
+    StaticTask_t xDummyTask;
+    #if ( configUSE_EDF_SCHEDULER == 1 )
+        TickType_t xDummyEDF1[ 4 ];
+        uint32_t ulDummyEDF2;
+    #endif
+    #if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_JOB_STATS == 1 ) )
+        uint8_t ucDummyEDF3;
+        uint32_t ulDummyEDF4[ 2 ];
+        uint64_t ullDummyEDF5[ 2 ];
+        EDFJobStats_t xDummyEDF6;
+    #endif
+    #if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_UTILIZATION == 1 ) )
+        uint64_t ullDummyEDF7[ 2 ];
+        uint32_t ulDummyEDF8[ 2 ];
+    #endif
+    #if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_OVERLOAD == 1 ) )
+        TickType_t xDummyEDF9;
+        UBaseType_t uxDummyEDF10;
+        void * pvDummyEDF11;
+        uint32_t ulDummyEDF12;
+    #endif
+    #if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_FIRM == 1 ) )
+        UBaseType_t uxDummyEDF25[ 3 ];
+        uint32_t ulDummyEDF26;
+    #endif
+    #if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_MIXED_CRITICALITY == 1 ) )
+        TickType_t xDummyEDF13[ 2 ];
+        uint8_t ucDummyEDF14;
+    #endif
+    #if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_ELASTIC == 1 ) )
+        TickType_t xDummyEDF15[ 3 ];
+        UBaseType_t uxDummyEDF16;
+        void * pvDummyEDF17;
+    #endif
+    #if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_MODES == 1 ) )
+        void * pvDummyEDF18;
+    #endif
+    #if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_LIMITED_PREEMPTION == 1 ) )
+        TickType_t xDummyEDF19;
+    #endif
+    #if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_PREEMPTION_THRESHOLD == 1 ) )
+        TickType_t xDummyEDF20;
+        BaseType_t xDummyEDF28;
+    #endif
+    #if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( ( configUSE_EDF_SLACK_STEALING == 1 ) || ( configUSE_EDF_DVS == 1 ) ) )
+        void * pvDummyEDF21;
+    #endif
+    #if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_SLACK_STEALING == 1 ) )
+        uint8_t ucDummyEDF22;
+    #endif
+    #if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_TBS == 1 ) )
+        TickType_t xDummyEDF23;
+    #endif
+    #if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_DVS == 1 ) )
+        uint32_t ulDummyEDF24;
+        uint64_t ullDummyEDF27;
+    #endif
+} StaticEDFTask_t;
+
+/*-----------------------------------------------------------
+* EDF TASK API
+*----------------------------------------------------------*/
+
+/**
+ * edf.h
+ * <pre>
+ * TaskHandle_t xTaskPeriodicCreateStatic( TaskFunction_t pxTaskCode,
+ *                                         const char * const pcName,
+ *                                         uint32_t ulStackDepth,
+ *                                         void *pvParameters,
+ *                                         UBaseType_t uxPriority,
+ *                                         StackType_t *puxStackBuffer,
+ *                                         StaticEDFTask_t *pxTaskBuffer,
+ *                                         TickType_t period );
+ * </pre>
+ *
+ * configUSE_EDF_SCHEDULER and configSUPPORT_STATIC_ALLOCATION must both be
+ * defined as 1 for this function to be available.
+ *
+ * Create a periodic task whose TCB and stack are provided by the caller, the
+ * way xTaskCreateStatic() does for an ordinary task.  The task is scheduled
+ * exactly as one created with xTaskPeriodicCreate(): its deadline is one
+ * period after its creation, and after each call to vTaskDelayUntil().
+ *
+ * @param puxStackBuffer Array of at least ulStackDepth StackType_t entries,
+ * used as the stack of the task.
+ *
+ * @param pxTaskBuffer Variable used to hold the TCB of the task.
+ *
+ * @param period Period of the task in ticks.
+ *
+ * The other parameters are as for xTaskCreateStatic().
+ *
+ * @return The handle of the task, or NULL if either buffer is NULL.
+ */
+TaskHandle_t xTaskPeriodicCreateStatic( TaskFunction_t pxTaskCode,
+                                        const char * const pcName, /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+                                        const uint32_t ulStackDepth,
+                                        void * const pvParameters,
+                                        UBaseType_t uxPriority,
+                                        StackType_t * const puxStackBuffer,
+                                        StaticEDFTask_t * const pxTaskBuffer,
+                                        TickType_t period ) PRIVILEGED_FUNCTION;
+
+/**
+ * edf.h
+ * <pre>
+ * void vApplicationGetEDFIdleTaskMemory( StaticEDFTask_t ** ppxIdleTaskTCBBuffer,
+ *                                        StackType_t ** ppxIdleTaskStackBuffer,
+ *                                        uint32_t * pulIdleTaskStackSize );
+ * </pre>
+ *
+ * When configUSE_EDF_SCHEDULER and configSUPPORT_STATIC_ALLOCATION are both 1
+ * the application must provide this function instead of
+ * vApplicationGetIdleTaskMemory(), to supply the memory the periodic idle
+ * task is created in.
+ */
+void vApplicationGetEDFIdleTaskMemory( StaticEDFTask_t ** ppxIdleTaskTCBBuffer,
+                                       StackType_t ** ppxIdleTaskStackBuffer,
+                                       uint32_t * pulIdleTaskStackSize ); /*lint !e526 Symbol not defined as it is an application callback. */
+
+/**
+ * edf.h
+ * <pre>
+ * uint32_t ulTaskSporadicWait( void );
+ * </pre>
+ *
+ * configUSE_EDF_SCHEDULER and configUSE_TASK_NOTIFICATIONS must both be
+ * defined as 1 for this function to be available.
+ *
+ * The sporadic counterpart of vTaskDelayUntil().  Ends the current job of the
+ * calling task and blocks until the next one is released by
+ * vTaskSporadicReleaseFromISR().  The new job has a deadline
+ * xRelativeDeadline ticks after its release, see vTaskSetEDFParameters().
+ *
+ * A sporadic task is created with xTaskPeriodicCreate() or
+ * xTaskPeriodicCreateStatic(), with its minimum inter-arrival time as the
+ * period, and must not use notification index 0 for anything else.
+ *
+ * @return The number of releases since the last call, more than one if
+ * releases arrived while the last job was still running.  They are served
+ * by a single job.
+ */
+uint32_t ulTaskSporadicWait( void ) PRIVILEGED_FUNCTION;
+
+/**
+ * edf.h
+ * <pre>
+ * void vTaskSporadicReleaseFromISR( TaskHandle_t xTask,
+ *                                   BaseType_t * pxHigherPriorityTaskWoken );
+ * </pre>
+ *
+ * Releases a job of the sporadic task xTask from an interrupt.  If the task
+ * is waiting in ulTaskSporadicWait() the job gets its deadline from the tick
+ * count now, otherwise when the task next calls ulTaskSporadicWait().
+ *
+ * @param pxHigherPriorityTaskWoken Set to pdTRUE if the released job has an
+ * earlier deadline than the running one, in which case a context switch
+ * should be requested before the interrupt exits.
+ */
+void vTaskSporadicReleaseFromISR( TaskHandle_t xTask,
+                                  BaseType_t * pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+
+/**
+ * edf.h
+ * <pre>
+ * void vTaskGetJobStats( TaskHandle_t xTask, EDFJobStats_t * pxJobStats );
+ * </pre>
+ *
+ * configUSE_EDF_SCHEDULER and configUSE_EDF_JOB_STATS must both be defined as
+ * 1 for this function to be available.
+ *
+ * Takes a consistent copy of the job statistics the kernel has collected for
+ * xTask.  The means are computed here, so the per job cost inside the kernel
+ * stays constant.
+ *
+ * @param xTask Handle of the task to query.  Passing NULL queries the calling
+ * task.
+ *
+ * @param pxJobStats Structure the statistics are copied into.  If no job has
+ * completed yet all the members are zero.
+ */
+void vTaskGetJobStats( TaskHandle_t xTask,
+                       EDFJobStats_t * pxJobStats ) PRIVILEGED_FUNCTION;
+
+/**
+ * edf.h
+ * <pre>
+ * void vTaskResetJobStats( TaskHandle_t xTask );
+ * </pre>
+ *
+ * Clears the job statistics of xTask.  Passing NULL clears the statistics of
+ * the calling task.  The job that is currently in progress, if any, is still
+ * recorded when it completes.
+ */
+void vTaskResetJobStats( TaskHandle_t xTask ) PRIVILEGED_FUNCTION;
+
+/**
+ * edf.h
+ * <pre>
+ * void vTaskSetEDFParameters( TaskHandle_t xTask,
+ *                             TickType_t xRelativeDeadline,
+ *                             TickType_t xBudget );
+ * </pre>
+ *
+ * configUSE_EDF_SCHEDULER must be defined as 1 for this function to be
+ * available.
+ *
+ * Tasks created with xTaskPeriodicCreate() have a deadline equal to their
+ * period and no declared budget.  This sets a constrained deadline and the
+ * worst case execution time of the task.  A new deadline takes effect from
+ * the next release, the job in progress keeps the one it has.
+ *
+ * @param xTask The task to change.  Passing NULL changes the calling task.
+ *
+ * @param xRelativeDeadline Deadline of each job relative to its release, in
+ * ticks.  Must be greater than zero and not greater than the period.
+ *
+ * @param xBudget Worst case execution time in ticks, or 0 if unknown.
+ */
+void vTaskSetEDFParameters( TaskHandle_t xTask,
+                            TickType_t xRelativeDeadline,
+                            TickType_t xBudget ) PRIVILEGED_FUNCTION;
+
+/**
+ * edf.h
+ * <pre>
+ * void vTaskSetEDFValue( TaskHandle_t xTask, UBaseType_t uxValue );
+ * </pre>
+ *
+ * configUSE_EDF_SCHEDULER and configUSE_EDF_OVERLOAD must both be defined as
+ * 1 for this function to be available.
+ *
+ * Sets the value of the jobs of a periodic task.  Under overload the kernel
+ * sheds the jobs of the lowest value first.  A shed job is never dispatched,
+ * the task stays in vTaskDelayUntil() until its next release, one period
+ * later, and the wake time it passed is moved on to match.  Only jobs that
+ * have not started can be shed.
+ *
+ * @param xTask The task to change.  Passing NULL changes the calling task.
+ *
+ * @param uxValue Value of each job, 0, the default, if the jobs of the task
+ * must never be shed.
+ */
+void vTaskSetEDFValue( TaskHandle_t xTask,
+                       UBaseType_t uxValue ) PRIVILEGED_FUNCTION;
+
+/**
+ * edf.h
+ * <pre>
+ * void vTaskSetEDFFirm( TaskHandle_t xTask,
+ *                       UBaseType_t uxMaxSkipped,
+ *                       UBaseType_t uxWindow );
+ * </pre>
+ *
+ * configUSE_EDF_SCHEDULER and configUSE_EDF_FIRM must both be defined as 1 for
+ * this function to be available.
+ *
+ * Makes a periodic task (m,k)-firm, see configUSE_EDF_FIRM: of any uxWindow
+ * jobs in a row at most uxMaxSkipped are skipped or complete late.  Its
+ * history starts afresh.
+ *
+ * @param xTask The task to change.  Passing NULL changes the calling task.
+ *
+ * @param uxMaxSkipped m, less than uxWindow.
+ *
+ * @param uxWindow k, at most 32, or 0 if the task is not firm.
+ */
+void vTaskSetEDFFirm( TaskHandle_t xTask,
+                      UBaseType_t uxMaxSkipped,
+                      UBaseType_t uxWindow ) PRIVILEGED_FUNCTION;
+
+/**
+ * edf.h
+ * <pre>
+ * void vTaskSetEDFCriticality( TaskHandle_t xTask,
+ *                              TickType_t xBudgetHigh,
+ *                              TickType_t xVirtualDeadline );
+ * </pre>
+ *
+ * configUSE_EDF_SCHEDULER and configUSE_EDF_MIXED_CRITICALITY must both be
+ * defined as 1 for this function to be available.
+ *
+ * Makes xTask a task of HI criticality, see configUSE_EDF_MIXED_CRITICALITY.
+ * Its LO budget is the one set by vTaskSetEDFParameters().  Takes effect
+ * from the next release.
+ *
+ * @param xTask The task to change.  Passing NULL changes the calling task.
+ *
+ * @param xBudgetHigh Worst case execution time in ticks in HI mode, not less
+ * than the LO budget.  0 makes the task of LO criticality again.
+ *
+ * @param xVirtualDeadline Deadline of each job relative to its release in LO
+ * mode, in ticks.  Not greater than the relative deadline, usually the
+ * relative deadline scaled by the EDF-VD factor of the task set.
+ */
+void vTaskSetEDFCriticality( TaskHandle_t xTask,
+                             TickType_t xBudgetHigh,
+                             TickType_t xVirtualDeadline ) PRIVILEGED_FUNCTION;
+
+/**
+ * edf.h
+ * <pre>
+ * BaseType_t xTaskGetEDFCriticalityMode( void );
+ * </pre>
+ *
+ * @return edfCRITICALITY_LO or edfCRITICALITY_HI.
+ */
+BaseType_t xTaskGetEDFCriticalityMode( void ) PRIVILEGED_FUNCTION;
+
+/**
+ * edf.h
+ * <pre>
+ * void vTaskSetEDFElastic( TaskHandle_t xTask,
+ *                          TickType_t xPeriodMax,
+ *                          UBaseType_t uxElasticity );
+ * </pre>
+ *
+ * configUSE_EDF_SCHEDULER and configUSE_EDF_ELASTIC must both be defined as 1
+ * for this function to be available.
+ *
+ * Registers a periodic task with xTaskEDFElasticAdapt(), see
+ * configUSE_EDF_ELASTIC.  Its shortest period is the one it was created with.
+ * From then on the task is released at the period the kernel gives it, and
+ * the increment it passes to vTaskDelayUntil() is ignored.  A task with a
+ * constrained deadline keeps it, a deadline equal to the period follows the
+ * period.  Register every periodic task, with an elasticity of 0 for those
+ * that must keep their period, as only the registered tasks are counted.
+ *
+ * @param xTask The task to register.  Passing NULL registers the calling task.
+ *
+ * @param xPeriodMax Longest period of the task in ticks, not less than the
+ * period it was created with.
+ *
+ * @param uxElasticity Share of the compression the task takes relative to the
+ * other elastic tasks, 0 to keep its period.
+ */
+void vTaskSetEDFElastic( TaskHandle_t xTask,
+                         TickType_t xPeriodMax,
+                         UBaseType_t uxElasticity ) PRIVILEGED_FUNCTION;
+
+/**
+ * edf.h
+ * <pre>
+ * BaseType_t xTaskEDFElasticAdapt( uint32_t ulTargetUtilization );
+ * </pre>
+ *
+ * configUSE_EDF_SCHEDULER and configUSE_EDF_ELASTIC must both be defined as 1
+ * for this function to be available.
+ *
+ * Recomputes the periods of the tasks registered with vTaskSetEDFElastic() so
+ * the sum of their budgets over their periods does not exceed
+ * ulTargetUtilization.  Periods start from their shortest, and only when the
+ * tasks do not fit are the elastic ones stretched, none beyond its longest
+ * period.  Call it after a task is created or deleted, or after its budget has
+ * been changed with vTaskSetEDFParameters(), for example from measured
+ * execution times.  Tasks without a budget keep their period.
+ *
+ * @param ulTargetUtilization Utilization to fit in, in parts per million.
+ *
+ * @return pdPASS if the tasks fit, pdFAIL if they do not even at their longest
+ * periods, which they are then given.
+ */
+BaseType_t xTaskEDFElasticAdapt( uint32_t ulTargetUtilization ) PRIVILEGED_FUNCTION;
+
+/**
+ * edf.h
+ * <pre>
+ * BaseType_t xTaskEDFModeChange( const EDFModeChange_t * pxChange );
+ * </pre>
+ *
+ * configUSE_EDF_SCHEDULER and configUSE_EDF_MODES must both be defined as 1
+ * for this function to be available.
+ *
+ * Requests a mode change, see configUSE_EDF_MODES.  The next time the idle
+ * task runs, once every job in progress has completed, the tasks in pxStop
+ * are suspended and those in pxStart are released, a periodic task counting
+ * its next periods from there.  Nothing is allocated.  Called before
+ * the scheduler starts the change is applied at once, which selects the
+ * first mode.
+ *
+ * @param pxChange The tasks to stop and start.
+ *
+ * @return pdPASS if the change was accepted, pdFAIL if another one has not
+ * been applied yet.
+ */
+BaseType_t xTaskEDFModeChange( const EDFModeChange_t * pxChange ) PRIVILEGED_FUNCTION;
+
+/**
+ * edf.h
+ * <pre>
+ * BaseType_t xTaskEDFModeChangePending( void );
+ * </pre>
+ *
+ * @return pdTRUE if a mode change has been requested but not applied yet.
+ */
+BaseType_t xTaskEDFModeChangePending( void ) PRIVILEGED_FUNCTION;
+
+/**
+ * edf.h
+ * <pre>
+ * void vTaskSetEDFNonPreemptive( TaskHandle_t xTask, TickType_t xRegion );
+ * </pre>
+ *
+ * configUSE_EDF_SCHEDULER and configUSE_EDF_LIMITED_PREEMPTION must both be
+ * defined as 1 for this function to be available.
+ *
+ * Sets the length of the non-preemptive regions of a task, see
+ * configUSE_EDF_LIMITED_PREEMPTION.  A region delays the jobs with earlier
+ * deadlines by up to its length, which the schedulability test of the task
+ * set must count as blocking.
+ *
+ * @param xTask The task to change.  Passing NULL changes the calling task.
+ *
+ * @param xRegion Longest time in ticks the task runs before it can be
+ * preempted, 0, the default, for a task that can always be preempted.
+ */
+void vTaskSetEDFNonPreemptive( TaskHandle_t xTask,
+                               TickType_t xRegion ) PRIVILEGED_FUNCTION;
+
+/**
+ * edf.h
+ * <pre>
+ * void vTaskEDFPreemptionPoint( void );
+ * </pre>
+ *
+ * configUSE_EDF_SCHEDULER and configUSE_EDF_LIMITED_PREEMPTION must both be
+ * defined as 1 for this function to be available.
+ *
+ * Ends the non-preemptive region of the calling task.  A preemption held back
+ * by the region is taken here, otherwise a new region starts.  A task that
+ * calls it at least every region length is only ever preempted at these
+ * points.
+ */
+void vTaskEDFPreemptionPoint( void ) PRIVILEGED_FUNCTION;
+
+/**
+ * edf.h
+ * <pre>
+ * void vTaskSetEDFThreshold( TaskHandle_t xTask, TickType_t xThreshold );
+ * </pre>
+ *
+ * configUSE_EDF_SCHEDULER and configUSE_EDF_PREEMPTION_THRESHOLD must both be
+ * defined as 1 for this function to be available.
+ *
+ * Sets the preemption threshold of a task, see
+ * configUSE_EDF_PREEMPTION_THRESHOLD.  Once a job of the task runs, only the
+ * jobs of tasks whose relative deadline is shorter than xThreshold preempt
+ * it.  The other jobs with earlier deadlines can be blocked for a whole job
+ * of the task, which the schedulability test of the task set must count.
+ *
+ * @param xTask The task to change.  Passing NULL changes the calling task.
+ *
+ * @param xThreshold Threshold in ticks, not greater than the relative
+ * deadline of the task.  0, the default, keeps plain EDF preemption and 1
+ * makes the jobs of the task non-preemptive.
+ */
+void vTaskSetEDFThreshold( TaskHandle_t xTask,
+                           TickType_t xThreshold ) PRIVILEGED_FUNCTION;
+
+/**
+ * edf.h
+ * <pre>
+ * void vTaskSetEDFSoft( TaskHandle_t xTask );
+ * </pre>
+ *
+ * configUSE_EDF_SCHEDULER and configUSE_EDF_SLACK_STEALING must both be
+ * defined as 1 for this function to be available.
+ *
+ * Makes a sporadic task soft, see configUSE_EDF_SLACK_STEALING.  Its jobs are
+ * released by vTaskSporadicReleaseFromISR() as usual but run in the slack of
+ * the hard tasks instead of to a deadline of their own, so its deadline
+ * misses mean nothing.  A released job waits for the next tick for its first
+ * share of the slack.
+ *
+ * @param xTask The task to make soft.  Passing NULL makes the calling task
+ * soft.
+ */
+void vTaskSetEDFSoft( TaskHandle_t xTask ) PRIVILEGED_FUNCTION;
+
+/**
+ * edf.h
+ * <pre>
+ * void vTaskSetEDFServer( TaskHandle_t xTask, uint32_t ulBandwidth );
+ * </pre>
+ *
+ * configUSE_EDF_SCHEDULER and configUSE_EDF_TBS must both be defined as 1 for
+ * this function to be available.
+ *
+ * Makes a sporadic task a Total Bandwidth Server, see configUSE_EDF_TBS.  Its
+ * jobs are released by vTaskSporadicReleaseFromISR() as usual, with the
+ * budget set by vTaskSetEDFParameters() as the execution time of a request,
+ * so call this after vTaskSetEDFParameters().  Releases that arrive while a
+ * job is still running are served by one job, so the budget has to cover
+ * them.
+ *
+ * @param xTask The task to make a server.  Passing NULL makes the calling
+ * task a server.
+ *
+ * @param ulBandwidth The bandwidth Us of the server in parts per million, or
+ * 0 to give the task plain r + D deadlines again.
+ */
+void vTaskSetEDFServer( TaskHandle_t xTask,
+                        uint32_t ulBandwidth ) PRIVILEGED_FUNCTION;
+
+/**
+ * edf.h
+ * <pre>
+ * void vTaskGetEDFInfo( TaskHandle_t xTask, EDFTaskStatus_t * pxEDFStatus );
+ * </pre>
+ *
+ * configUSE_EDF_SCHEDULER must be defined as 1 for this function to be
+ * available.
+ *
+ * Populates an EDFTaskStatus_t structure for a single task.  Use
+ * uxTaskGetSystemStateEDF() to get the information for every task at once.
+ *
+ * @param xTask The task to query.  Passing NULL queries the calling task.
+ *
+ * @param pxEDFStatus The structure to fill in.
+ */
+void vTaskGetEDFInfo( TaskHandle_t xTask,
+                      EDFTaskStatus_t * pxEDFStatus ) PRIVILEGED_FUNCTION;
+
+/**
+ * edf.h
+ * <pre>
+ * UBaseType_t uxTaskGetSystemStateEDF( TaskStatus_t * const pxTaskStatusArray,
+ *                                      EDFTaskStatus_t * const pxEDFStatusArray,
+ *                                      const UBaseType_t uxArraySize,
+ *                                      uint32_t * const pulCpuLoad );
+ * </pre>
+ *
+ * configUSE_TRACE_FACILITY must be defined as 1 for this function to be
+ * available.
+ *
+ * Same as uxTaskGetSystemState(), but also fills in pxEDFStatusArray in the
+ * same walk of the task lists, so the scheduler is not held suspended any
+ * longer than it is by uxTaskGetSystemState() itself.
+ *
+ * @param pxTaskStatusArray, uxArraySize As for uxTaskGetSystemState().
+ *
+ * @param pxEDFStatusArray Array of at least uxArraySize entries.  Can be NULL
+ * if only the CPU load is wanted.
+ *
+ * @param pulCpuLoad If not NULL, set to the CPU load of the last completed
+ * utilization window in tenths of a percent, or zero if
+ * configUSE_EDF_UTILIZATION is 0.
+ *
+ * @return The number of entries filled in, or zero if uxArraySize is too small.
+ */
+UBaseType_t uxTaskGetSystemStateEDF( TaskStatus_t * const pxTaskStatusArray,
+                                     EDFTaskStatus_t * const pxEDFStatusArray,
+                                     const UBaseType_t uxArraySize,
+                                     uint32_t * const pulCpuLoad ) PRIVILEGED_FUNCTION;
+
+/**
+ * edf.h
+ * <pre>
+ * uint32_t ulTaskGetCpuLoad( void );
+ * </pre>
+ *
+ * configUSE_EDF_SCHEDULER and configUSE_EDF_UTILIZATION must both be defined
+ * as 1 for this function to be available.
+ *
+ * @return The CPU load of the last completed utilization window, in tenths
+ * of a percent.  Computed from the time the idle task did not run.
+ */
+uint32_t ulTaskGetCpuLoad( void ) PRIVILEGED_FUNCTION;
+
+/**
+ * edf.h
+ * <pre>
+ * uint32_t ulTaskGetEDFSpeed( void );
+ * </pre>
+ *
+ * configUSE_EDF_SCHEDULER and configUSE_EDF_DVS must both be defined as 1 for
+ * this function to be available.
+ *
+ * @return The speed last passed to configEDF_DVS_SET_SPEED(), in parts per
+ * million of the full speed.
+ */
+uint32_t ulTaskGetEDFSpeed( void ) PRIVILEGED_FUNCTION;
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+    }
+#endif
+/* *INDENT-ON* */
+#endif /* INC_EDF_H */
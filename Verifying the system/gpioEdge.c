@@ -0,0 +1,226 @@
+/*
+ * E.C. : Button edges through the external interrupts, see gpioEdge.h.
+ */
+
+/* Scheduler includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "edf.h"
+#include "lpc21xx.h"
+
+#include "gpioEdge.h"
+
+/*-----------------------------------------------------------*/
+
+#define gpioVIC_SLOT_ENABLE			( ( unsigned long ) 0x20 )
+#define gpioEINT0_VIC_CHANNEL		( 14 )
+
+/* The vectored address and control registers are consecutive words. */
+#define gpioVIC_VECT_ADDR( slot )	( ( &VICVectAddr0 )[ slot ] )
+#define gpioVIC_VECT_CNTL( slot )	( ( &VICVectCntl0 )[ slot ] )
+
+/* Pin of each line, and where its EINT function is selected. */
+typedef struct
+{
+	unsigned long ulPin;				/* Bit of the pin in IO0PIN. */
+	volatile unsigned long * pulPinsel;	/* PINSEL0 or PINSEL1. */
+	unsigned long ulPinselShift;		/* Position of the pin in it. */
+	unsigned long ulPinselFunction;		/* Value selecting EINTn. */
+} GpioEdgePin_t;
+
+/* State of a line. */
+typedef struct
+{
+	TaskHandle_t xTask;					/* Task released by the edges. */
+	uint32_t ulLastAccepted;			/* Timer 1 count of the last delivered edge. */
+	GpioEdge_t xEdge;					/* Last delivered edge. */
+	pinState_t xLevel;					/* Level of the pin when it was last read, bounces included. */
+} GpioEdgeLine_t;
+
+static const GpioEdgePin_t xPins[ gpioEDGE_LINES ] =
+{
+	{ ( 1UL << 16 ), &PINSEL1, 0,  1 },	/* EINT0 on P0.16 */
+	{ ( 1UL << 14 ), &PINSEL0, 28, 2 },	/* EINT1 on P0.14 */
+	{ ( 1UL << 15 ), &PINSEL0, 30, 2 },	/* EINT2 on P0.15 */
+	{ ( 1UL << 20 ), &PINSEL1, 8,  3 }	/* EINT3 on P0.20 */
+};
+
+static GpioEdgeLine_t xLines[ gpioEDGE_LINES ];
+
+static void prvTrackLevel( UBaseType_t uxLine );
+static void prvHandleEdge( UBaseType_t uxLine );
+static void prvDeliverEdge( GpioEdgeLine_t * pxLine, uint32_t ulNow );
+static void prvEint0ISR( void ) __irq;
+static void prvEint1ISR( void ) __irq;
+static void prvEint2ISR( void ) __irq;
+static void prvEint3ISR( void ) __irq;
+
+static void ( * const pxISRs[ gpioEDGE_LINES ] )( void ) =
+{
+	prvEint0ISR, prvEint1ISR, prvEint2ISR, prvEint3ISR
+};
+
+/*-----------------------------------------------------------*/
+
+void vGpioEdgeInit( UBaseType_t uxLine, TaskHandle_t xTask )
+{
+	const GpioEdgePin_t * pxPin = &xPins[ uxLine ];
+	GpioEdgeLine_t * pxLine = &xLines[ uxLine ];
+	unsigned long ulBit = 1UL << uxLine;
+
+	configASSERT( uxLine < gpioEDGE_LINES );
+
+	portENTER_CRITICAL();
+	{
+		/* The pin is still a GPIO, so its level can be read.  The interrupt
+		 * waits for the opposite one. */
+		pxLine->xTask = xTask;
+		pxLine->xLevel = ( ( IO0PIN & pxPin->ulPin ) != 0 ) ? PIN_IS_HIGH : PIN_IS_LOW;
+		pxLine->xEdge.xLevel = pxLine->xLevel;
+		pxLine->xEdge.ulTimestamp = T1TC;
+		pxLine->ulLastAccepted = T1TC - gpioEDGE_DEBOUNCE_COUNTS;
+
+		EXTMODE |= ulBit;
+		if( pxLine->xLevel == PIN_IS_HIGH )
+		{
+			EXTPOLAR &= ~ulBit;
+		}
+		else
+		{
+			EXTPOLAR |= ulBit;
+		}
+
+		*( pxPin->pulPinsel ) = ( *( pxPin->pulPinsel ) & ~( 3UL << pxPin->ulPinselShift ) ) | ( pxPin->ulPinselFunction << pxPin->ulPinselShift );
+
+		/* Changing the mode or the pin function can flag a false edge. */
+		EXTINT = ulBit;
+
+		gpioVIC_VECT_ADDR( gpioEDGE_VIC_SLOT + uxLine ) = ( unsigned long ) pxISRs[ uxLine ];
+		gpioVIC_VECT_CNTL( gpioEDGE_VIC_SLOT + uxLine ) = gpioVIC_SLOT_ENABLE | ( gpioEINT0_VIC_CHANNEL + uxLine );
+		VICIntEnable = 1UL << ( gpioEINT0_VIC_CHANNEL + uxLine );
+	}
+	portEXIT_CRITICAL();
+}
+/*-----------------------------------------------------------*/
+
+void vGpioEdgeGet( UBaseType_t uxLine, GpioEdge_t * pxEdge )
+{
+	configASSERT( uxLine < gpioEDGE_LINES );
+
+	portENTER_CRITICAL();
+	{
+		*pxEdge = xLines[ uxLine ].xEdge;
+	}
+	portEXIT_CRITICAL();
+}
+/*-----------------------------------------------------------*/
+
+static void prvTrackLevel( UBaseType_t uxLine )
+{
+	const GpioEdgePin_t * pxPin = &xPins[ uxLine ];
+	GpioEdgeLine_t * pxLine = &xLines[ uxLine ];
+	unsigned long ulBit = 1UL << uxLine;
+
+	/* IO0PIN reads the pin whatever its function.  Several bounces can set
+	 * EXTINT only once, so the level is read rather than toggled, and the
+	 * interrupt waits for the edge away from it.  Changing the polarity can
+	 * flag a false edge, and the pin can move while it is changed, so read
+	 * it again until it holds still. */
+	do
+	{
+		pxLine->xLevel = ( ( IO0PIN & pxPin->ulPin ) != 0 ) ? PIN_IS_HIGH : PIN_IS_LOW;
+		if( pxLine->xLevel == PIN_IS_HIGH )
+		{
+			EXTPOLAR &= ~ulBit;
+		}
+		else
+		{
+			EXTPOLAR |= ulBit;
+		}
+		EXTINT = ulBit;
+	} while( pxLine->xLevel != ( ( ( IO0PIN & pxPin->ulPin ) != 0 ) ? PIN_IS_HIGH : PIN_IS_LOW ) );
+}
+/*-----------------------------------------------------------*/
+
+static void prvHandleEdge( UBaseType_t uxLine )
+{
+	GpioEdgeLine_t * pxLine = &xLines[ uxLine ];
+	uint32_t ulNow = T1TC;
+
+	/* This runs for every edge, bounces too, to keep xLevel right. */
+	prvTrackLevel( uxLine );
+
+	if( ( pxLine->xLevel != pxLine->xEdge.xLevel ) &&
+		( ( ulNow - pxLine->ulLastAccepted ) >= gpioEDGE_DEBOUNCE_COUNTS ) )
+	{
+		prvDeliverEdge( pxLine, ulNow );
+	}
+}
+/*-----------------------------------------------------------*/
+
+void vGpioEdgeTick( void )
+{
+	GpioEdgeLine_t * pxLine;
+	UBaseType_t uxLine;
+	uint32_t ulNow = T1TC;
+
+	/* An edge inside the window, a release shortly after a press say, was
+	 * only tracked.  Once the window has closed the level it left the pin at
+	 * is delivered, if it is not the one the task was last given. */
+	for( uxLine = 0; uxLine < gpioEDGE_LINES; uxLine++ )
+	{
+		pxLine = &xLines[ uxLine ];
+		if( pxLine->xTask == NULL )
+		{
+			continue;
+		}
+
+		/* The tick cannot be interrupted by the lines on this port, so the
+		 * pin is read again here in case an edge left no interrupt behind. */
+		prvTrackLevel( uxLine );
+
+		if( ( pxLine->xLevel != pxLine->xEdge.xLevel ) &&
+			( ( ulNow - pxLine->ulLastAccepted ) >= gpioEDGE_DEBOUNCE_COUNTS ) )
+		{
+			prvDeliverEdge( pxLine, ulNow );
+		}
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvDeliverEdge( GpioEdgeLine_t * pxLine, uint32_t ulNow )
+{
+	pxLine->ulLastAccepted = ulNow;
+	pxLine->xEdge.ulTimestamp = ulNow;
+	pxLine->xEdge.xLevel = pxLine->xLevel;
+
+	/* These handlers are not wrapped in the port context save, so they
+	 * cannot switch context themselves.  The kernel switches to the task
+	 * at the next tick at the latest. */
+	vTaskSporadicReleaseFromISR( pxLine->xTask, NULL );
+}
+/*-----------------------------------------------------------*/
+
+static void prvEint0ISR( void ) __irq
+{
+	prvHandleEdge( gpioEDGE_EINT0 );
+	VICVectAddr = 0;
+}
+
+static void prvEint1ISR( void ) __irq
+{
+	prvHandleEdge( gpioEDGE_EINT1 );
+	VICVectAddr = 0;
+}
+
+static void prvEint2ISR( void ) __irq
+{
+	prvHandleEdge( gpioEDGE_EINT2 );
+	VICVectAddr = 0;
+}
+
+static void prvEint3ISR( void ) __irq
+{
+	prvHandleEdge( gpioEDGE_EINT3 );
+	VICVectAddr = 0;
+}
@@ -0,0 +1,61 @@
+/*
+ * E.C. : Button edges through the external interrupts of the LPC21xx.
+ *
+ * Each line watches one EINT pin for both edges.  An edge is time stamped
+ * with timer 1 in the interrupt, and releases a job of the sporadic task
+ * attached to the line with vTaskSporadicReleaseFromISR(), so the task only
+ * runs when the pin actually changed.
+ *
+ * Debouncing is done in the interrupt: the first edge is delivered at once,
+ * further edges within gpioEDGE_DEBOUNCE_COUNTS of it are only tracked.  If
+ * they leave the pin at another level, vGpioEdgeTick() delivers that level
+ * once the window has closed.  The debounce window is also the minimum
+ * inter-arrival time of the task, and should be the period it is created
+ * with.
+ */
+
+#ifndef GPIO_EDGE_H
+#define GPIO_EDGE_H
+
+#include "FreeRTOS.h"
+#include "task.h"
+#include "GPIO.h"
+
+/* Debounce window in timer 1 counts.  Timer 1 runs at 60 counts per ms, see
+ * configTimer1() in main.c. */
+#ifndef gpioEDGE_DEBOUNCE_COUNTS
+	#define gpioEDGE_DEBOUNCE_COUNTS	( 20UL * 60UL )
+#endif
+
+/* First vectored slot of the VIC used by the lines, line n uses slot
+ * gpioEDGE_VIC_SLOT + n.  Slot 0 is the tick and slot 2 the UART. */
+#ifndef gpioEDGE_VIC_SLOT
+	#define gpioEDGE_VIC_SLOT			3
+#endif
+
+/* The lines, with the pin each of them uses on the LPC2129. */
+#define gpioEDGE_EINT0		0	/* P0.16 */
+#define gpioEDGE_EINT1		1	/* P0.14 */
+#define gpioEDGE_EINT2		2	/* P0.15 */
+#define gpioEDGE_EINT3		3	/* P0.20 */
+#define gpioEDGE_LINES		4
+
+/* Last edge delivered on a line. */
+typedef struct
+{
+	uint32_t ulTimestamp;	/* Timer 1 count of the edge. */
+	pinState_t xLevel;		/* Level of the pin after the edge. */
+} GpioEdge_t;
+
+/* Attach the sporadic task xTask to line uxLine, switch the pin to its EINT
+ * function and enable the interrupt.  Call before the scheduler starts. */
+void vGpioEdgeInit( UBaseType_t uxLine, TaskHandle_t xTask );
+
+/* Copy the last edge delivered on uxLine into pxEdge. */
+void vGpioEdgeGet( UBaseType_t uxLine, GpioEdge_t * pxEdge );
+
+/* Deliver the level the pin of each line settled at, if an edge inside the
+ * debounce window changed it.  Call from vApplicationTickHook(). */
+void vGpioEdgeTick( void );
+
+#endif /* GPIO_EDGE_H */
@@ -60,12 +60,18 @@
 /* Scheduler includes. */
 #include "FreeRTOS.h"
 #include "task.h"
+#include "edf.h"
 #include "lpc21xx.h"
 #include "queue.h"
+#include "spscChannel.h"
+#include "blockPool.h"
+#include "taskSet.h"
 
 /* Peripheral includes. */
 #include "serial.h"
+#include "serialTx.h"
 #include "GPIO.h"
+#include "gpioEdge.h"
 
 
 /*-----------------------------------------------------------*/
@@ -77,18 +83,52 @@
 #define mainCOM_TEST_BAUD_RATE	( ( unsigned long ) 115200 )
 
 
-#define BUTTON1_PORT		PORT_0
-#define BUTTON1_PIN			PIN0
+#define BUTTON1_LINE		gpioEDGE_EINT0		/* P0.16 */
+#define BUTTON2_LINE		gpioEDGE_EINT1		/* P0.14 */
 
-#define BUTTON2_PORT		PORT_0
-#define BUTTON2_PIN			PIN1
+/* Edges from each Button_x_Monitor to Uart_Receiver, through a channel of
+its own so each channel has a single producer.  A power of 2. */
+#define BUTTON_MESSAGES		2
 
-#define BUTTON1_PERIOD				50
-#define BUTTON2_PERIOD				50
-#define PERIODIC_PERIOD		  	100
-#define UART_PERIOD					  20
-#define LOAD1_PERIOD					10
-#define LOAD2_PERIOD					100
+typedef struct
+{
+	TickType_t xDeadline;	/* Tick count by which it should be printed. */
+	char cEdge;				/* What Uart_Receiver prints. */
+} ButtonMessage_t;
+
+/* Frames from Periodic_Transmitter to Uart_Receiver, passed by pointer. */
+#define PERIODIC_FRAMES		2
+
+typedef struct
+{
+	uint32_t ulSequence;	/* Counts the frames sent. */
+	TickType_t xTimestamp;	/* Tick count when the frame was filled in. */
+	char cTag;				/* What Uart_Receiver prints. */
+} PeriodicFrame_t;
+
+/* With mainBENCHMARK set to 1 in taskSet.h, the Benchmark task snapshots the
+EDF statistics of the task set into Benchmark_Results, to be read with the
+debugger.  Built once per configEDF_VARIANT, it runs the same workload on each
+kernel variant. */
+#if ( mainBENCHMARK == 1 )
+	#define TASK_COUNT( function, name, stack, period, deadline, wcet, wcet_hi, value, period_max, elasticity, npr, threshold, skip_m, skip_k )	+ 1
+	#define mainBENCHMARK_TASKS		( ( 0 TASK_SET( TASK_COUNT ) ) + 1 )	/* and the idle task */
+
+	typedef struct
+	{
+		const char * pcName;
+		uint32_t ulDeadlineMisses;
+		uint32_t ulJobCount;
+		uint32_t ulResponseMax;			/* timer 1 counts */
+		uint32_t ulStartLatencyMax;		/* timer 1 counts */
+		uint32_t ulUtilization;			/* tenths of a percent */
+	} BenchmarkResult_t;
+
+	BenchmarkResult_t Benchmark_Results[ mainBENCHMARK_TASKS ];
+	uint32_t Benchmark_Cpu_Load;		/* tenths of a percent */
+	uint32_t Benchmark_Overhead;		/* Cpu_Load minus the utilization of every task, tenths of a percent */
+	uint32_t Benchmark_Snapshots;
+#endif
 
 unsigned int Button_1_Start, Button_1_Total;
 unsigned int Button_2_Start, Button_2_Total;
@@ -99,15 +139,30 @@ unsigned int Load_2_Start, Load_2_total;
 unsigned int System_Time;
 unsigned int Cpu_Load;									
 
-BaseType_t xReturned;
-QueueHandle_t xMessage_Buffer1 = NULL;
+SpscChannel_t xButton_1_Channel;
+SpscChannel_t xButton_2_Channel;
+BlockPool_t xPeriodic_Frames;
+BlockChannel_t xPeriodic_Channel;
+
+/* Handle, stack and TCB of every task of the task set. */
+#define TASK_MEMORY( function, name, stack, period, deadline, wcet, wcet_hi, value, period_max, elasticity, npr, threshold, skip_m, skip_k )	\
+	TaskHandle_t function##_Handler = NULL;								\
+	static StackType_t function##_Stack[ stack ];						\
+	static StaticEDFTask_t function##_TCB;
 
-TaskHandle_t Button_1_Monitor_Handler = NULL;
-TaskHandle_t Button_2_Monitor_Handler = NULL;
-TaskHandle_t Periodic_Transmitter_Handler = NULL;
-TaskHandle_t Uart_Receiver_Handler = NULL;
-TaskHandle_t Load_1_Simulation_Handler = NULL;
-TaskHandle_t Load_2_Simulation_Handler = NULL;
+TASK_SET( TASK_MEMORY )
+
+/* Memory of the idle task, nothing is taken from the heap. */
+static StackType_t Idle_Stack[ configMINIMAL_STACK_SIZE ];
+static StaticEDFTask_t Idle_TCB;
+
+/* Memory of the button channels. */
+static spscCHANNEL_STORAGE( Button_1_Channel_Storage, ButtonMessage_t, BUTTON_MESSAGES );
+static spscCHANNEL_STORAGE( Button_2_Channel_Storage, ButtonMessage_t, BUTTON_MESSAGES );
+
+/* Memory of the frames and of the channel that carries them. */
+static blockPOOL_STORAGE( Periodic_Frames_Storage, sizeof( PeriodicFrame_t ), PERIODIC_FRAMES );
+static blockCHANNEL_STORAGE( Periodic_Channel_Storage, PERIODIC_FRAMES );
 
 /*
  * Configure the processor for use with the Keil demo board.  This is very
@@ -116,12 +171,55 @@ TaskHandle_t Load_2_Simulation_Handler = NULL;
  */
 static void prvSetupHardware( void );
 /*-----------------------------------------------------------*/
-void Button_1_Monitor( void * pvParameters );
-void Button_2_Monitor( void * pvParameters );
-void Periodic_Transmitter (void * pvParameters );
-void Uart_Receiver (void * pvParameters );
-void Load_1_Simulation ( void * pvParameters );
-void Load_2_Simulation ( void * pvParameters );
+#define TASK_PROTOTYPE( function, name, stack, period, deadline, wcet, wcet_hi, value, period_max, elasticity, npr, threshold, skip_m, skip_k )	void function( void * pvParameters );
+TASK_SET( TASK_PROTOTYPE )
+
+/* HI budget and virtual deadline of a task with a HI wcet, only used with EDF-VD. */
+#if ( configUSE_EDF_MIXED_CRITICALITY == 1 )
+	#define TASK_CRITICALITY( function, deadline, wcet_hi )	\
+		if( ( wcet_hi ) != 0 )	\
+		{	\
+			vTaskSetEDFCriticality( function##_Handler, TASK_SET_WCET_TICKS( wcet_hi ), TASK_SET_VIRTUAL_DEADLINE( deadline ) );	\
+		}
+#else
+	#define TASK_CRITICALITY( function, deadline, wcet_hi )
+#endif
+
+/* Value of the jobs of a task, only used when the kernel sheds jobs under overload. */
+#if ( configUSE_EDF_OVERLOAD == 1 )
+	#define TASK_VALUE( function, value )	vTaskSetEDFValue( function##_Handler, value );
+#else
+	#define TASK_VALUE( function, value )
+#endif
+
+/* Range of periods of a task, only used with elastic periods.  Every task is
+ * registered, so the ones that keep their period are counted too. */
+#if ( configUSE_EDF_ELASTIC == 1 )
+	#define TASK_ELASTIC( function, period_max, elasticity )	vTaskSetEDFElastic( function##_Handler, period_max, elasticity );
+#else
+	#define TASK_ELASTIC( function, period_max, elasticity )
+#endif
+
+/* Non-preemptive region of a task, only used with limited preemption. */
+#if ( configUSE_EDF_LIMITED_PREEMPTION == 1 )
+	#define TASK_NON_PREEMPTIVE( function, npr )	vTaskSetEDFNonPreemptive( function##_Handler, npr );
+#else
+	#define TASK_NON_PREEMPTIVE( function, npr )
+#endif
+
+/* Preemption threshold of a task, only used with preemption thresholds. */
+#if ( configUSE_EDF_PREEMPTION_THRESHOLD == 1 )
+	#define TASK_THRESHOLD( function, threshold )	vTaskSetEDFThreshold( function##_Handler, threshold );
+#else
+	#define TASK_THRESHOLD( function, threshold )
+#endif
+
+/* Jobs a firm task can skip, only used with (m,k)-firm tasks. */
+#if ( configUSE_EDF_FIRM == 1 )
+	#define TASK_FIRM( function, skip_m, skip_k )	vTaskSetEDFFirm( function##_Handler, skip_m, skip_k );
+#else
+	#define TASK_FIRM( function, skip_m, skip_k )
+#endif
 
 /*
  * Application entry point:
@@ -132,62 +230,40 @@ int main( void )
 	/* Setup the hardware for use with the Keil demo board. */
 	prvSetupHardware();
     /* Create Tasks here */
-	xReturned = xTaskPeriodicCreate(
-                    Button_1_Monitor,       /* Function that implements the task. */
-                    "BM1",     /* Text name for the task. */
-                    100,      				/* Stack size in words, not bytes. */
-                    ( void * ) 0,    		/* Parameter passed into the task. */
-                    1,						/* Priority at which the task is created. */
-                    &Button_1_Monitor_Handler		/* Used to pass out the created task's handle. */
-										,BUTTON1_PERIOD);      				/* Task Deadline */
-					
-	xReturned = xTaskPeriodicCreate(
-                    Button_2_Monitor,       /* Function that implements the task. */
-                    "BM2",     /* Text name for the task. */
-                    100,      				/* Stack size in words, not bytes. */
-                    ( void * ) 0,    		/* Parameter passed into the task. */
-                    1,						/* Priority at which the task is created. */
-                    &Button_2_Monitor_Handler,		/* Used to pass out the created task's handle. */
-										BUTTON2_PERIOD);      				/* Task Deadline */
-	    				
-	xReturned = xTaskPeriodicCreate(
-                    Periodic_Transmitter,       /* Function that implements the task. */
-                    "PT",     /* Text name for the task. */
-                    100,      				/* Stack size in words, not bytes. */
-                    ( void * ) 0,    		/* Parameter passed into the task. */
-                    1,						/* Priority at which the task is created. */
-                    &Periodic_Transmitter_Handler,		/* Used to pass out the created task's handle. */
-										PERIODIC_PERIOD);															/* Task Deadline */  
-	
-	xReturned = xTaskPeriodicCreate(
-                    Uart_Receiver,       /* Function that implements the task. */
-                    "UR",     /* Text name for the task. */
-                    100,      				/* Stack size in words, not bytes. */
-                    ( void * ) 0,    		/* Parameter passed into the task. */
-                    1,						/* Priority at which the task is created. */
-                    &Uart_Receiver_Handler,		/* Used to pass out the created task's handle. */
-										UART_PERIOD);      				/* Task Deadline */
-	
-	xReturned = xTaskPeriodicCreate(
-                    Load_2_Simulation,       /* Function that implements the task. */
-                    "LS2",     /* Text name for the task. */
-                    100,      				/* Stack size in words, not bytes. */
-                    ( void * ) 0,    		/* Parameter passed into the task. */
-                    1,						/* Priority at which the task is created. */
-                    &Load_2_Simulation_Handler,		/* Used to pass out the created task's handle. */
-										LOAD2_PERIOD);      				/* Task Deadline */
-		
-	xReturned = xTaskPeriodicCreate(
-                    Load_1_Simulation,       /* Function that implements the task. */
-                    "LS1",     /* Text name for the task. */
-                    100,      				/* Stack size in words, not bytes. */
-                    ( void * ) 0,    		/* Parameter passed into the task. */
-                    1,						/* Priority at which the task is created. */
-                    &Load_1_Simulation_Handler,		/* Used to pass out the created task's handle. */
-										LOAD1_PERIOD);      				/* Task Deadline */
-					
-	xMessage_Buffer1 = xQueueCreate( 3, sizeof(char));
-		
+#define TASK_CREATE( function, name, stack, period, deadline, wcet, wcet_hi, value, period_max, elasticity, npr, threshold, skip_m, skip_k )					\
+	function##_Handler = xTaskPeriodicCreateStatic( function,		/* Function that implements the task. */	\
+													name,			/* Text name for the task. */	\
+													stack,			/* Stack size in words, not bytes. */	\
+													( void * ) 0,	/* Parameter passed into the task. */	\
+													1,				/* Priority at which the task is created. */	\
+													function##_Stack,	\
+													&function##_TCB,	\
+													period );		/* Task Period */	\
+	vTaskSetEDFParameters( function##_Handler, deadline, TASK_SET_WCET_TICKS( wcet ) );	\
+	TASK_CRITICALITY( function, deadline, wcet_hi )	\
+	TASK_VALUE( function, value )	\
+	TASK_ELASTIC( function, period_max, elasticity )	\
+	TASK_NON_PREEMPTIVE( function, npr )	\
+	TASK_THRESHOLD( function, function##_Threshold )	\
+	TASK_FIRM( function, skip_m, skip_k )
+
+	TASK_SET( TASK_CREATE )
+
+	#if ( configUSE_EDF_ELASTIC == 1 )
+		/* The task set fits, so every task starts at its own period. */
+		( void ) xTaskEDFElasticAdapt( 1000000UL );
+	#endif
+
+	/* The button tasks are sporadic, released by the edges of their pins. */
+	vGpioEdgeInit( BUTTON1_LINE, Button_1_Monitor_Handler );
+	vGpioEdgeInit( BUTTON2_LINE, Button_2_Monitor_Handler );
+
+	/* Uart_Receiver polls, it is never notified. */
+	vSpscChannelInit( &xButton_1_Channel, Button_1_Channel_Storage, sizeof( ButtonMessage_t ), BUTTON_MESSAGES, NULL );
+	vSpscChannelInit( &xButton_2_Channel, Button_2_Channel_Storage, sizeof( ButtonMessage_t ), BUTTON_MESSAGES, NULL );
+	vBlockPoolInit( &xPeriodic_Frames, Periodic_Frames_Storage, sizeof( PeriodicFrame_t ), PERIODIC_FRAMES );
+	vBlockChannelInit( &xPeriodic_Channel, Periodic_Channel_Storage, PERIODIC_FRAMES );
+
 	/* Now all the tasks have been started - start the scheduler.
 
 	NOTE : Tasks run in system mode and the scheduler runs in Supervisor mode.
@@ -196,14 +272,27 @@ int main( void )
 	to supervisor mode prior to main being called.  If you are not using one of
 	these demo application projects then ensure Supervisor mode is used here. */
 	vTaskStartScheduler();
-	/* Should never reach here!  If you do then there was not enough heap
-	available for the idle task to be created. */
+	/* Should never reach here!  If you do then the idle task could not be
+	created. */
 	for( ;; );
 }
 /*-----------------------------------------------------------*/
 
+/* The idle task is periodic under EDF, so its TCB is a StaticEDFTask_t. */
+void vApplicationGetEDFIdleTaskMemory( StaticEDFTask_t ** ppxIdleTaskTCBBuffer,
+                                       StackType_t ** ppxIdleTaskStackBuffer,
+                                       uint32_t * pulIdleTaskStackSize )
+{
+	*ppxIdleTaskTCBBuffer = &Idle_TCB;
+	*ppxIdleTaskStackBuffer = Idle_Stack;
+	*pulIdleTaskStackSize = configMINIMAL_STACK_SIZE;
+}
+/*-----------------------------------------------------------*/
+
 void vApplicationTickHook (void)
 {
+	/* Edges that settled inside the debounce window of the buttons. */
+	vGpioEdgeTick();
 	GPIO_write(PORT_1 , PIN1, PIN_IS_HIGH);
 	GPIO_write(PORT_1 , PIN1, PIN_IS_LOW);
 }
@@ -229,6 +318,7 @@ static void prvSetupHardware( void )
 
 	/* Configure UART */
 	xSerialPortInitMinimal(mainCOM_TEST_BAUD_RATE);
+	vSerialTxInit();
 
 	/* Configure GPIO */
 	GPIO_init();
@@ -245,114 +335,167 @@ static void prvSetupHardware( void )
 /*Tasks Implemntations*/ 
 void Button_1_Monitor( void * pvParameters )
 {
-	uint32_t xLastWakeTime = xTaskGetTickCount();
+	ButtonMessage_t xMessage;
+	GpioEdge_t xEdge;
 	char Edge_Flag = 0;
 
 	for( ;; )
 	{
-		pinState_t Current_State = GPIO_read(BUTTON1_PORT,BUTTON1_PIN);
-		if( Current_State == PIN_IS_HIGH )
+		/* Sleep until the pin changes, every job reports one edge. */
+		ulTaskSporadicWait();
+		vGpioEdgeGet( BUTTON1_LINE, &xEdge );
+		if( xEdge.xLevel == PIN_IS_HIGH )
 		{
 			Edge_Flag = 'R';
 		}
-		else if (Current_State == PIN_IS_LOW )
+		else
 		{
 			Edge_Flag = 'F';
 		}
-		xQueueSend( xMessage_Buffer1  , &Edge_Flag ,(TickType_t) 0);
-		vTaskDelayUntil( &xLastWakeTime , BUTTON1_PERIOD);
+		/* To be printed before the next edge can arrive. */
+		xMessage.xDeadline = xTaskGetTickCount() + Button_1_Monitor_Period;
+		xMessage.cEdge = Edge_Flag;
+		xSpscChannelSend( &xButton_1_Channel, &xMessage );
 	}
 }
 
 void Button_2_Monitor( void * pvParameters )
 {
-	uint32_t xLastWakeTime = xTaskGetTickCount();
+	ButtonMessage_t xMessage;
+	GpioEdge_t xEdge;
 	char Edge_Flag = 0;
+
 	for( ;; )
 	{
-		pinState_t Current_State = GPIO_read(BUTTON2_PORT,BUTTON2_PIN);
-		if( Current_State == PIN_IS_HIGH )
+		/* Sleep until the pin changes, every job reports one edge. */
+		ulTaskSporadicWait();
+		vGpioEdgeGet( BUTTON2_LINE, &xEdge );
+		if( xEdge.xLevel == PIN_IS_HIGH )
 		{
 			Edge_Flag = 'r';
 		}
-		else if (Current_State == PIN_IS_LOW)
+		else
 		{
 			Edge_Flag = 'f';
 		}
-		xQueueSend( xMessage_Buffer1  , &Edge_Flag ,(TickType_t) 0);
-		vTaskDelayUntil( &xLastWakeTime , BUTTON2_PERIOD);
+		/* To be printed before the next edge can arrive. */
+		xMessage.xDeadline = xTaskGetTickCount() + Button_2_Monitor_Period;
+		xMessage.cEdge = Edge_Flag;
+		xSpscChannelSend( &xButton_2_Channel, &xMessage );
 	}
 }
 
 void Periodic_Transmitter (void * pvParameters )
 {
 	uint32_t xLastWakeTime = xTaskGetTickCount();
-	char Edge_Flag = 0;
+	uint32_t ulSequence = 0;
+	PeriodicFrame_t * pxFrame;
 	for( ; ; )
 	{
-		 if(( uxQueueSpacesAvailable( xMessage_Buffer1 ) ) > 0 && (xMessage_Buffer1 != NULL) )
+		/* Fill the frame in place and hand it over, only the pointer is
+		copied.  If Uart_Receiver has not freed the last frames yet this
+		period is skipped, nothing blocks. */
+		pxFrame = ( PeriodicFrame_t * ) pvBlockPoolAlloc( &xPeriodic_Frames );
+		if( pxFrame != NULL )
 		{
-			Edge_Flag = 'P';
-			xQueueSend(xMessage_Buffer1,&Edge_Flag,PERIODIC_PERIOD ); 
+			pxFrame->ulSequence = ulSequence++;
+			pxFrame->xTimestamp = xTaskGetTickCount();
+			pxFrame->cTag = 'P';
+			if( xBlockChannelSend( &xPeriodic_Channel, pxFrame ) != pdPASS )
+			{
+				vBlockPoolFree( &xPeriodic_Frames, pxFrame );
+			}
 		}
-		vTaskDelayUntil( &xLastWakeTime , PERIODIC_PERIOD);
+		vTaskDelayUntil( &xLastWakeTime , Periodic_Transmitter_Period);
 	}
 }
 
 void Uart_Receiver (void * pvParameters )
 {
 	uint32_t xLastWakeTime = xTaskGetTickCount();
-	char Received_message1;
-	char Received_message2;
-	char Received_message3;
+	ButtonMessage_t * pxMessage1;
+	ButtonMessage_t * pxMessage2;
+	ButtonMessage_t * pxMessage;
+	PeriodicFrame_t * pxFrame;
+	uint32_t ulMessages1, ulMessages2;
+	UBaseType_t uxFrames;
+	/* "BTx=e\n" for every message the channels can hold, "PT=P\n" for every frame. */
+	char Line[ ( 6 * 2 * BUTTON_MESSAGES ) + ( 5 * PERIODIC_FRAMES ) ];
+	char * pcLine;
 
 	for( ; ; )
 	{
-		if( xQueueReceive( xMessage_Buffer1, &(Received_message1) , 0) && ((Received_message1 == 'R') ||(Received_message1 == 'F')))
+		/* Print the button messages, most urgent first, then the frames, as one line. */
+		pcLine = Line;
+
+		/* Only the messages already in the channels are printed.  A button job
+		can preempt this one and send more while the channels are drained, and
+		those would not fit in Line; they wait for the next period. */
+		ulMessages1 = xButton_1_Channel.ulHead - xButton_1_Channel.ulTail;
+		ulMessages2 = xButton_2_Channel.ulHead - xButton_2_Channel.ulTail;
+		for( ; ; )
 		{
-			xSerialPutChar('B');
-			xSerialPutChar('T');
-			xSerialPutChar('1');
-			xSerialPutChar('=');
-			xSerialPutChar(Received_message1);
-      xSerialPutChar('\n');		
-		}
-		else
-		{	
-			xSerialPutChar(' ');
-			xSerialPutChar(' ');
-			xSerialPutChar(' ');
+			/* Merge the two channels on the deadline of their oldest message. */
+			pxMessage1 = ( ulMessages1 != 0 ) ? ( ButtonMessage_t * ) pvSpscChannelPeek( &xButton_1_Channel ) : NULL;
+			pxMessage2 = ( ulMessages2 != 0 ) ? ( ButtonMessage_t * ) pvSpscChannelPeek( &xButton_2_Channel ) : NULL;
+			if( ( pxMessage1 != NULL ) &&
+				( ( pxMessage2 == NULL ) || ( ( BaseType_t ) ( pxMessage1->xDeadline - pxMessage2->xDeadline ) <= 0 ) ) )
+			{
+				pxMessage = pxMessage1;
+				*pcLine++ = 'B';
+				*pcLine++ = 'T';
+				*pcLine++ = '1';
+			}
+			else if( pxMessage2 != NULL )
+			{
+				pxMessage = pxMessage2;
+				*pcLine++ = 'B';
+				*pcLine++ = 'T';
+				*pcLine++ = '2';
+			}
+			else
+			{
+				break;
+			}
+			*pcLine++ = '=';
+			*pcLine++ = pxMessage->cEdge;
+			*pcLine++ = '\n';
+			if( pxMessage == pxMessage1 )
+			{
+				vSpscChannelConsume( &xButton_1_Channel );
+				ulMessages1--;
+			}
+			else
+			{
+				vSpscChannelConsume( &xButton_2_Channel );
+				ulMessages2--;
+			}
 		}
-		if( xQueueReceive( xMessage_Buffer1, &(Received_message2) , 0) && ((Received_message2 == 'r') ||(Received_message2 == 'f')))
+
+		/* A frame freed below can be filled and sent again before the loop
+		ends, so no more frames than the pool holds are taken. */
+		for( uxFrames = 0; uxFrames < PERIODIC_FRAMES; uxFrames++ )
 		{
-			xSerialPutChar('B');
-			xSerialPutChar('T');
-			xSerialPutChar('2');
-			xSerialPutChar('=');
-			xSerialPutChar(Received_message2);
-		  xSerialPutChar('\n');
+			pxFrame = ( PeriodicFrame_t * ) pvBlockChannelReceive( &xPeriodic_Channel, 0 );
+			if( pxFrame == NULL )
+			{
+				break;
+			}
+			*pcLine++ = 'P';
+			*pcLine++ = 'T';
+			*pcLine++ = '=';
+			*pcLine++ = pxFrame->cTag;
+			*pcLine++ = '\n';
+			/* Done with the frame, it goes back to the pool. */
+			vBlockPoolFree( &xPeriodic_Frames, pxFrame );
 		}
-		else
-		{	
-			xSerialPutChar(' ');
-			xSerialPutChar(' ');
-			xSerialPutChar(' ');
-		}
-		if( xQueueReceive( xMessage_Buffer1, &(Received_message3) , 0) && (Received_message3 == 'P'))
+		/* If the UART is still busy with earlier lines this one is dropped
+		rather than waited for, so the job time stays bounded. */
+		if( pcLine != Line )
 		{
-			xSerialPutChar('P');
-			xSerialPutChar('T');
-			xSerialPutChar('=');
-			xSerialPutChar(Received_message3);
-			xSerialPutChar('\n');
-		}
-		else
-		{	
-			xSerialPutChar(' ');
-			xSerialPutChar(' ');
-			xSerialPutChar(' ');
+			xSerialPutBuffer( Line, ( uint32_t ) ( pcLine - Line ) );
 		}
-		vTaskDelayUntil( &xLastWakeTime , UART_PERIOD);
+		vTaskDelayUntil( &xLastWakeTime , Uart_Receiver_Period);
 	}
 }
 
@@ -366,7 +509,7 @@ void Load_1_Simulation ( void * pvParameters )
 		for( i=0 ; i <=x; i++)
 		{
 		}
-		vTaskDelayUntil( &xLastWakeTime , LOAD1_PERIOD);
+		vTaskDelayUntil( &xLastWakeTime , Load_1_Simulation_Period);
 	}
 }
 
@@ -380,6 +523,47 @@ void Load_2_Simulation ( void * pvParameters )
 		for( i=0 ; i <= x; i++)
 		{
 		}
-		vTaskDelayUntil( &xLastWakeTime , LOAD2_PERIOD);
+		vTaskDelayUntil( &xLastWakeTime , Load_2_Simulation_Period);
 	}
-}
\ No newline at end of file
+}
+
+#if ( mainBENCHMARK == 1 )
+void Benchmark( void * pvParameters )
+{
+	TickType_t xLastWakeTime = xTaskGetTickCount();
+	static TaskStatus_t xStatus[ mainBENCHMARK_TASKS ];
+	static EDFTaskStatus_t xEDFStatus[ mainBENCHMARK_TASKS ];
+	EDFJobStats_t xJobStats;
+	UBaseType_t uxTasks, x;
+	uint32_t ulCpuLoad, ulTasksLoad;
+
+	for( ; ; )
+	{
+		vTaskDelayUntil( &xLastWakeTime , Benchmark_Period);
+
+		uxTasks = uxTaskGetSystemStateEDF( xStatus, xEDFStatus, mainBENCHMARK_TASKS, &ulCpuLoad );
+		ulTasksLoad = 0;
+		for( x = 0; x < uxTasks; x++ )
+		{
+			vTaskGetJobStats( xStatus[ x ].xHandle, &xJobStats );
+			Benchmark_Results[ x ].pcName = xStatus[ x ].pcTaskName;
+			Benchmark_Results[ x ].ulDeadlineMisses = xEDFStatus[ x ].ulDeadlineMisses;
+			Benchmark_Results[ x ].ulJobCount = xJobStats.ulJobCount;
+			Benchmark_Results[ x ].ulResponseMax = xJobStats.ulResponseMax;
+			Benchmark_Results[ x ].ulStartLatencyMax = xJobStats.ulStartLatencyMax;
+			Benchmark_Results[ x ].ulUtilization = xEDFStatus[ x ].ulUtilization;
+			if( xStatus[ x ].xHandle != xTaskGetIdleTaskHandle() )
+			{
+				ulTasksLoad += xEDFStatus[ x ].ulUtilization;
+			}
+		}
+
+		/* What is left of the load once every task, this one included, is
+		accounted for is spent in the kernel: ticks, switches and the EDF
+		bookkeeping. */
+		Benchmark_Cpu_Load = ulCpuLoad;
+		Benchmark_Overhead = ( ulCpuLoad > ulTasksLoad ) ? ( ulCpuLoad - ulTasksLoad ) : 0;
+		Benchmark_Snapshots++;
+	}
+}
+#endif
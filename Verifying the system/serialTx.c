@@ -0,0 +1,151 @@
+/*
+ * E.C. : Interrupt driven, buffered transmit path of UART0, see serialTx.h.
+ */
+
+/* Standard includes. */
+#include <string.h>
+
+/* Scheduler includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "lpc21xx.h"
+
+#include "serialTx.h"
+
+/*-----------------------------------------------------------*/
+
+#if ( ( serialTX_BUFFER_SIZE & ( serialTX_BUFFER_SIZE - 1 ) ) != 0 )
+	#error serialTX_BUFFER_SIZE must be a power of 2
+#endif
+
+#define serTX_INDEX_MASK			( ( uint32_t ) ( serialTX_BUFFER_SIZE - 1 ) )
+
+/* Depth of the transmit FIFO of the LPC21xx UARTs. */
+#define serTX_FIFO_SIZE				16
+
+/* UART0 registers bits and VIC settings. */
+#define serUART0_VIC_CHANNEL		( 6 )
+#define serUART0_VIC_CHANNEL_BIT	( ( unsigned long ) 1 << serUART0_VIC_CHANNEL )
+#define serVIC_SLOT_ENABLE			( ( unsigned long ) 0x20 )
+#define serTHRE_INT_ENABLE			( ( unsigned long ) 0x02 )
+#define serINTERRUPT_PENDING		( ( unsigned long ) 0x01 )
+#define serINTERRUPT_SOURCE_MASK	( ( unsigned long ) 0x0e )
+#define serSOURCE_THRE				( ( unsigned long ) 0x02 )
+#define serFIFO_ENABLE_AND_RESET_TX	( ( unsigned long ) 0x05 )
+
+#define serVIC_VECT_ADDR( slot )	serVIC_VECT_ADDR_( slot )
+#define serVIC_VECT_ADDR_( slot )	VICVectAddr##slot
+#define serVIC_VECT_CNTL( slot )	serVIC_VECT_CNTL_( slot )
+#define serVIC_VECT_CNTL_( slot )	VICVectCntl##slot
+
+/*-----------------------------------------------------------*/
+
+/* The ring.  ulTxHead is only written by xSerialPutBuffer() and ulTxTail only
+ * by the interrupt, so neither side needs a critical section to move data. */
+static char cTxBuffer[ serialTX_BUFFER_SIZE ];
+static volatile uint32_t ulTxHead = 0;
+static volatile uint32_t ulTxTail = 0;
+
+/* pdTRUE when the FIFO has drained and no interrupt will follow, so the next
+ * message has to start the transmission itself. */
+static volatile BaseType_t xTxIdle = pdTRUE;
+
+static void prvUart0ISR( void ) __irq;
+static BaseType_t prvFillTxFifo( void );
+
+/*-----------------------------------------------------------*/
+
+void vSerialTxInit( void )
+{
+	portENTER_CRITICAL();
+	{
+		ulTxHead = 0;
+		ulTxTail = 0;
+		xTxIdle = pdTRUE;
+
+		/* The FIFO must be enabled for the interrupt to load 16 bytes at a time. */
+		U0FCR = serFIFO_ENABLE_AND_RESET_TX;
+
+		serVIC_VECT_ADDR( serialTX_VIC_SLOT ) = ( unsigned long ) prvUart0ISR;
+		serVIC_VECT_CNTL( serialTX_VIC_SLOT ) = serVIC_SLOT_ENABLE | serUART0_VIC_CHANNEL;
+		VICIntEnable = serUART0_VIC_CHANNEL_BIT;
+
+		U0IER |= serTHRE_INT_ENABLE;
+	}
+	portEXIT_CRITICAL();
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xSerialPutBuffer( const char * pcBuffer, uint32_t ulLength )
+{
+	uint32_t ulHead = ulTxHead;
+	uint32_t ulFree = ( ulTxTail - ulHead - 1UL ) & serTX_INDEX_MASK;
+	uint32_t ulFirst;
+
+	if( ulLength > ulFree )
+	{
+		return pdFAIL;
+	}
+
+	/* At most two copies, either side of the end of the ring. */
+	ulFirst = serialTX_BUFFER_SIZE - ulHead;
+	if( ulFirst > ulLength )
+	{
+		ulFirst = ulLength;
+	}
+	memcpy( &cTxBuffer[ ulHead ], pcBuffer, ulFirst );
+	memcpy( &cTxBuffer[ 0 ], pcBuffer + ulFirst, ulLength - ulFirst );
+
+	/* Publish the message only once it is fully in the ring. */
+	ulTxHead = ( ulHead + ulLength ) & serTX_INDEX_MASK;
+
+	/* THRE only interrupts when the FIFO empties, so a message queued while
+	 * the UART is idle loads the FIFO from here. */
+	if( xTxIdle != pdFALSE )
+	{
+		portENTER_CRITICAL();
+		{
+			if( xTxIdle != pdFALSE )
+			{
+				xTxIdle = prvFillTxFifo() ? pdFALSE : pdTRUE;
+			}
+		}
+		portEXIT_CRITICAL();
+	}
+
+	return pdPASS;
+}
+/*-----------------------------------------------------------*/
+
+/* Move up to one FIFO worth of bytes from the ring to the UART.  Returns pdTRUE
+ * if anything was written, in which case a THRE interrupt will follow. */
+static BaseType_t prvFillTxFifo( void )
+{
+	uint32_t ulTail = ulTxTail;
+	uint32_t ulHead = ulTxHead;
+	BaseType_t xCount = 0;
+
+	while( ( ulTail != ulHead ) && ( xCount < serTX_FIFO_SIZE ) )
+	{
+		U0THR = cTxBuffer[ ulTail ];
+		ulTail = ( ulTail + 1UL ) & serTX_INDEX_MASK;
+		xCount++;
+	}
+
+	ulTxTail = ulTail;
+
+	return ( xCount > 0 ) ? pdTRUE : pdFALSE;
+}
+/*-----------------------------------------------------------*/
+
+static void prvUart0ISR( void ) __irq
+{
+	/* Reading U0IIR also clears a pending THRE interrupt. */
+	if( ( U0IIR & ( serINTERRUPT_PENDING | serINTERRUPT_SOURCE_MASK ) ) == serSOURCE_THRE )
+	{
+		xTxIdle = prvFillTxFifo() ? pdFALSE : pdTRUE;
+	}
+
+	/* Acknowledge the interrupt at the VIC. */
+	VICVectAddr = 0;
+}
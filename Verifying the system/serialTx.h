@@ -0,0 +1,39 @@
+/*
+ * E.C. : Interrupt driven, buffered transmit path of UART0.
+ *
+ * xSerialPutBuffer() copies a whole message into a ring buffer and returns;
+ * the UART0 interrupt moves it to the 16 byte transmit FIFO of the LPC21xx,
+ * up to 16 bytes per interrupt.  The cost of a message for the sending task
+ * is one copy, independent of the baud rate and of what is still being sent.
+ *
+ * The ring has a single producer: only one task may call xSerialPutBuffer(),
+ * and xSerialPutChar() of serial.h must not be used for UART0 once
+ * vSerialTxInit() has been called, or the two paths interleave their bytes.
+ */
+
+#ifndef SERIAL_TX_H
+#define SERIAL_TX_H
+
+#include "FreeRTOS.h"
+
+/* Size of the transmit ring in bytes, must be a power of 2.  One byte is
+ * kept free to tell a full ring from an empty one. */
+#ifndef serialTX_BUFFER_SIZE
+	#define serialTX_BUFFER_SIZE		128
+#endif
+
+/* Vectored slot of the VIC used for the UART0 interrupt.  Slot 0 is taken by
+ * the tick interrupt of the port. */
+#ifndef serialTX_VIC_SLOT
+	#define serialTX_VIC_SLOT			2
+#endif
+
+/* Call once, after xSerialPortInitMinimal() and before the scheduler starts. */
+void vSerialTxInit( void );
+
+/* Queue ulLength bytes for transmission.  The message is either queued whole,
+ * and pdPASS returned, or not at all, and pdFAIL returned if the ring does not
+ * have room for it.  Never blocks. */
+BaseType_t xSerialPutBuffer( const char * pcBuffer, uint32_t ulLength );
+
+#endif /* SERIAL_TX_H */
@@ -0,0 +1,151 @@
+/*
+ * E.C. : Wait-free single producer single consumer channel, see spscChannel.h.
+ */
+
+/* Standard includes. */
+#include <string.h>
+
+/* Scheduler includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+
+#include "spscChannel.h"
+
+/*-----------------------------------------------------------*/
+
+static BaseType_t prvWrite( SpscChannel_t * pxChannel, const void * pvItem );
+
+/*-----------------------------------------------------------*/
+
+void vSpscChannelInit( SpscChannel_t * pxChannel, uint8_t * pucStorage, UBaseType_t uxItemSize, UBaseType_t uxLength, TaskHandle_t xConsumer )
+{
+	configASSERT( ( uxLength != 0 ) && ( ( uxLength & ( uxLength - 1 ) ) == 0 ) );
+
+	pxChannel->ulHead = 0;
+	pxChannel->ulTail = 0;
+	pxChannel->pucStorage = pucStorage;
+	pxChannel->uxItemSize = uxItemSize;
+	pxChannel->ulMask = ( uint32_t ) uxLength - 1UL;
+	pxChannel->xConsumer = xConsumer;
+	pxChannel->xConsumerWaiting = pdFALSE;
+	pxChannel->ulDropped = 0;
+}
+/*-----------------------------------------------------------*/
+
+/* Copy the item into the free slot and publish it.  Returns pdFALSE if the
+ * channel is full. */
+static BaseType_t prvWrite( SpscChannel_t * pxChannel, const void * pvItem )
+{
+	uint32_t ulHead = pxChannel->ulHead;
+
+	if( ( ulHead - pxChannel->ulTail ) > pxChannel->ulMask )
+	{
+		pxChannel->ulDropped++;
+		return pdFALSE;
+	}
+
+	memcpy( &( pxChannel->pucStorage[ ( ulHead & pxChannel->ulMask ) * pxChannel->uxItemSize ] ), pvItem, pxChannel->uxItemSize );
+	spscCOMPILER_BARRIER();
+	pxChannel->ulHead = ulHead + 1UL;
+
+	return pdTRUE;
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xSpscChannelSend( SpscChannel_t * pxChannel, const void * pvItem )
+{
+	if( prvWrite( pxChannel, pvItem ) == pdFALSE )
+	{
+		return errQUEUE_FULL;
+	}
+
+	/* The consumer set the flag before its last look at ulHead, so either it
+	 * saw the item or it is seen waiting here. */
+	if( pxChannel->xConsumerWaiting != pdFALSE )
+	{
+		xTaskNotifyGive( pxChannel->xConsumer );
+	}
+
+	return pdPASS;
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xSpscChannelSendFromISR( SpscChannel_t * pxChannel, const void * pvItem, BaseType_t * pxHigherPriorityTaskWoken )
+{
+	if( prvWrite( pxChannel, pvItem ) == pdFALSE )
+	{
+		return errQUEUE_FULL;
+	}
+
+	if( pxChannel->xConsumerWaiting != pdFALSE )
+	{
+		vTaskNotifyGiveFromISR( pxChannel->xConsumer, pxHigherPriorityTaskWoken );
+	}
+
+	return pdPASS;
+}
+/*-----------------------------------------------------------*/
+
+void * pvSpscChannelPeek( SpscChannel_t * pxChannel )
+{
+	uint32_t ulTail = pxChannel->ulTail;
+
+	if( pxChannel->ulHead == ulTail )
+	{
+		return NULL;
+	}
+
+	spscCOMPILER_BARRIER();
+
+	return &( pxChannel->pucStorage[ ( ulTail & pxChannel->ulMask ) * pxChannel->uxItemSize ] );
+}
+/*-----------------------------------------------------------*/
+
+void vSpscChannelConsume( SpscChannel_t * pxChannel )
+{
+	spscCOMPILER_BARRIER();
+	pxChannel->ulTail = pxChannel->ulTail + 1UL;
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xSpscChannelReceive( SpscChannel_t * pxChannel, void * pvItem, TickType_t xTicksToWait )
+{
+	void * pvSlot = pvSpscChannelPeek( pxChannel );
+	TimeOut_t xTimeOut;
+
+	if( ( pvSlot == NULL ) && ( pxChannel->xConsumer != NULL ) && ( xTicksToWait > ( TickType_t ) 0 ) )
+	{
+		vTaskSetTimeOutState( &xTimeOut );
+
+		/* Say we are about to wait before looking again, see
+		 * xSpscChannelSend(). */
+		pxChannel->xConsumerWaiting = pdTRUE;
+		spscCOMPILER_BARRIER();
+
+		for( ;; )
+		{
+			pvSlot = pvSpscChannelPeek( pxChannel );
+
+			/* A notification left over from an earlier wait can wake us with
+			 * the channel still empty, so wait again for what is left. */
+			if( ( pvSlot != NULL ) || ( xTaskCheckForTimeOut( &xTimeOut, &xTicksToWait ) != pdFALSE ) )
+			{
+				break;
+			}
+
+			( void ) ulTaskNotifyTake( pdTRUE, xTicksToWait );
+		}
+
+		pxChannel->xConsumerWaiting = pdFALSE;
+	}
+
+	if( pvSlot == NULL )
+	{
+		return pdFAIL;
+	}
+
+	memcpy( pvItem, pvSlot, pxChannel->uxItemSize );
+	vSpscChannelConsume( pxChannel );
+
+	return pdPASS;
+}
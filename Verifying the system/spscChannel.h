@@ -0,0 +1,66 @@
+/*
+ * E.C. : Wait-free channel between one producer and one consumer.
+ *
+ * The producer only ever writes ulHead and the consumer only ever writes
+ * ulTail, each with a single aligned 32 bit store, so neither side needs a
+ * critical section, interrupts are never masked and neither side can be
+ * held up by the other.  The producer can be a task or an interrupt.
+ *
+ * Optionally the consumer can block on the channel.  It then publishes that
+ * it is waiting, and the producer notifies it, on notification index 0, only
+ * in that case; a consumer that polls costs the producer nothing.  A
+ * consumer that blocks must not also be a sporadic EDF task, which uses the
+ * same notification.
+ */
+
+#ifndef SPSC_CHANNEL_H
+#define SPSC_CHANNEL_H
+
+#include "FreeRTOS.h"
+#include "task.h"
+
+/* Stops the compiler moving the copy of an item across the index store that
+ * publishes it.  A single core ARM7 needs no barrier instruction. */
+#ifndef spscCOMPILER_BARRIER
+	#if defined( __CC_ARM )
+		#define spscCOMPILER_BARRIER()		__memory_changed()
+	#else
+		#define spscCOMPILER_BARRIER()		__asm volatile ( "" ::: "memory" )
+	#endif
+#endif
+
+typedef struct
+{
+	volatile uint32_t ulHead;				/* Items written, only changed by the producer. */
+	volatile uint32_t ulTail;				/* Items read, only changed by the consumer. */
+	uint8_t * pucStorage;					/* uxLength items of uxItemSize bytes. */
+	UBaseType_t uxItemSize;
+	uint32_t ulMask;						/* uxLength - 1, uxLength is a power of 2. */
+	TaskHandle_t xConsumer;					/* Task notified by the producer, NULL if it never blocks. */
+	volatile BaseType_t xConsumerWaiting;	/* Set by a consumer about to block. */
+	uint32_t ulDropped;						/* Items the producer found no room for, only changed by the producer. */
+} SpscChannel_t;
+
+/* Declare the storage of a channel of uxLength items of xType. */
+#define spscCHANNEL_STORAGE( xName, xType, uxLength )	uint8_t xName[ sizeof( xType ) * ( uxLength ) ]
+
+/* uxLength must be a power of 2.  xConsumer is the task that may block in
+ * xSpscChannelReceive(), or NULL if the consumer only polls. */
+void vSpscChannelInit( SpscChannel_t * pxChannel, uint8_t * pucStorage, UBaseType_t uxItemSize, UBaseType_t uxLength, TaskHandle_t xConsumer );
+
+/* Copy an item in.  Returns pdPASS, or errQUEUE_FULL at once if there is no
+ * room.  Never blocks. */
+BaseType_t xSpscChannelSend( SpscChannel_t * pxChannel, const void * pvItem );
+BaseType_t xSpscChannelSendFromISR( SpscChannel_t * pxChannel, const void * pvItem, BaseType_t * pxHigherPriorityTaskWoken );
+
+/* The oldest item, read in place, or NULL if the channel is empty.  It stays
+ * in the channel until vSpscChannelConsume() is called. */
+void * pvSpscChannelPeek( SpscChannel_t * pxChannel );
+void vSpscChannelConsume( SpscChannel_t * pxChannel );
+
+/* Copy the oldest item out, waiting up to xTicksToWait for one if the
+ * channel was given a consumer task.  Returns pdPASS, or pdFAIL if none
+ * arrived. */
+BaseType_t xSpscChannelReceive( SpscChannel_t * pxChannel, void * pvItem, TickType_t xTicksToWait );
+
+#endif /* SPSC_CHANNEL_H */
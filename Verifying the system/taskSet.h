@@ -0,0 +1,224 @@
+/*
+ * E.C. : The task set of the demo, as one table.
+ *
+ * Each TASK() entry lists, in order:
+ *	function	- function that implements the task, also used to name its
+ *				  handle, stack and TCB in main.c.
+ *	name		- text name, as used by the trace macros in FreeRTOSConfig.h.
+ *	stack		- stack size in words, not bytes.
+ *	period		- period in ticks, for a sporadic task its minimum
+ *				  inter-arrival time.
+ *	deadline	- deadline relative to each release in ticks, <= period.
+ *	wcet		- measured worst case execution time in microseconds.
+ *	wcet_hi		- worst case execution time in microseconds the task must still
+ *				  be guaranteed in HI criticality mode, 0 for a task of LO
+ *				  criticality, whose jobs are dropped in HI mode.
+ *	value		- value of each job under overload, the least valuable jobs are
+ *				  shed first and 0 marks a task whose jobs are never shed.
+ *	period_max	- longest period in ticks the task can be stretched to under
+ *				  load, equal to period for a task that keeps its period.
+ *	elasticity	- share of the stretching the task takes relative to the other
+ *				  elastic tasks, 0 for a task that keeps its period.
+ *	npr			- longest non-preemptive region in ticks, 0 for a task that can
+ *				  always be preempted.
+ *	threshold	- preemption threshold in ticks, <= deadline.  Once a job runs,
+ *				  only tasks with a shorter deadline preempt it.  0 for plain
+ *				  EDF, -1 to have the shortest threshold that keeps the set
+ *				  schedulable picked at compile time.
+ *	skip_m		- jobs the task can skip in any skip_k jobs in a row, < skip_k.
+ *				  A job that cannot meet its deadline is skipped rather than
+ *				  run late while the task can afford it.
+ *	skip_k		- window of skip_m, <= 32, 0 for a task that is not firm.
+ *
+ * main.c expands the table to create the tasks, and the checks at the end of
+ * this file expand it to refuse to build a task set EDF cannot schedule.
+ */
+
+#ifndef TASK_SET_H
+#define TASK_SET_H
+
+/* Set mainBENCHMARK to 1, for example from the build target, to add the
+ * Benchmark task of main.c to the table.  It snapshots the EDF statistics of
+ * the task set every ten hyperperiods, and is checked and budgeted like any
+ * other task. */
+#ifndef mainBENCHMARK
+	#define mainBENCHMARK			0
+#endif
+
+#if ( mainBENCHMARK == 1 )
+	#define TASK_SET_BENCHMARK( TASK )	\
+	TASK( Benchmark,			"BENCH",	100,	1000,	1000,		2000,	0,		0,		1000,		0,			0,	0,			0,		0 )
+#else
+	#define TASK_SET_BENCHMARK( TASK )
+#endif
+
+/*		  function				name	stack	period	deadline	wcet	wcet_hi	value	period_max	elasticity	npr	threshold	skip_m	skip_k */
+#define TASK_SET( TASK )																												\
+	TASK( Button_1_Monitor,		"BM1",	100,	20,		20,			26,		52,		0,		20,			0,			0,	0,			0,		0 )		\
+	TASK( Button_2_Monitor,		"BM2",	100,	20,		20,			26,		52,		0,		20,			0,			0,	0,			0,		0 )		\
+	TASK( Periodic_Transmitter,	"PT",	100,	100,	100,		28,		0,		3,		150,		1,			0,	-1,			1,		4 )		\
+	TASK( Uart_Receiver,		"UR",	100,	20,		20,			30,		0,		0,		20,			0,			0,	0,			0,		0 )		\
+	TASK( Load_2_Simulation,	"LS2",	100,	100,	100,		12000,	0,		1,		150,		2,			3,	-1,			1,		2 )		\
+	TASK( Load_1_Simulation,	"LS1",	100,	10,		10,			5000,	0,		2,		10,			0,			0,	0,			0,		0 )		\
+	TASK_SET_BENCHMARK( TASK )
+
+/* Period of each task, for vTaskDelayUntil(), named <function>_Period. */
+#define TASK_SET_PERIOD( function, name, stack, period, deadline, wcet, wcet_hi, value, period_max, elasticity, npr, threshold, skip_m, skip_k )	function##_Period = ( period ),
+enum { TASK_SET( TASK_SET_PERIOD ) TASK_SET_PERIOD_END };
+
+/* Length of one tick in microseconds, the unit of the wcet column. */
+#define TASK_SET_US_PER_TICK		( 1000000UL / configTICK_RATE_HZ )
+
+/* Worst case execution time rounded up to whole ticks, used as the budget. */
+#define TASK_SET_WCET_TICKS( wcet )	( ( TickType_t ) ( ( ( wcet ) + TASK_SET_US_PER_TICK - 1UL ) / TASK_SET_US_PER_TICK ) )
+
+/*-----------------------------------------------------------
+ * Compile time schedulability checks.
+ *
+ * Shares are in parts per million and rounded up, so rounding can only make a
+ * check fail, never pass a task set that does not fit.
+ *----------------------------------------------------------*/
+
+#define TASK_SET_SHARE_PPM( wcet, ticks )	\
+	( ( ( unsigned long long ) ( wcet ) * 1000000ULL + ( unsigned long long ) ( ticks ) * TASK_SET_US_PER_TICK - 1ULL ) / ( ( unsigned long long ) ( ticks ) * TASK_SET_US_PER_TICK ) )
+
+#define TASK_SET_UTILIZATION( function, name, stack, period, deadline, wcet, wcet_hi, value, period_max, elasticity, npr, threshold, skip_m, skip_k )	+ TASK_SET_SHARE_PPM( wcet, period )
+#define TASK_SET_DENSITY( function, name, stack, period, deadline, wcet, wcet_hi, value, period_max, elasticity, npr, threshold, skip_m, skip_k )		+ TASK_SET_SHARE_PPM( wcet, deadline )
+#define TASK_SET_CONSTRAINED( function, name, stack, period, deadline, wcet, wcet_hi, value, period_max, elasticity, npr, threshold, skip_m, skip_k )	+ ( ( ( deadline ) > 0 ) && ( ( deadline ) <= ( period ) ) ? 0 : 1 )
+#define TASK_SET_ELASTIC( function, name, stack, period, deadline, wcet, wcet_hi, value, period_max, elasticity, npr, threshold, skip_m, skip_k )		+ ( ( period_max ) >= ( period ) ? 0 : 1 )
+
+/* Sum of wcet / period.  Above 1 no scheduler can meet every deadline. */
+#define TASK_SET_UTILIZATION_PPM	( 0ULL TASK_SET( TASK_SET_UTILIZATION ) )
+
+/* Sum of wcet / deadline.  For constrained deadlines the demand bound of the
+ * set over any interval t is at most t times this, so not exceeding 1 passes
+ * the demand bound test of EDF.  With every deadline equal to its period it is
+ * the utilization, and the test is exact. */
+#define TASK_SET_DENSITY_PPM		( 0ULL TASK_SET( TASK_SET_DENSITY ) )
+
+/* An array of negative size stops the build when a check fails. */
+typedef char TaskSetDeadlineNotConstrained[ ( ( 0 TASK_SET( TASK_SET_CONSTRAINED ) ) == 0 ) ? 1 : -1 ];
+typedef char TaskSetUtilizationAboveOne[ ( TASK_SET_UTILIZATION_PPM <= 1000000ULL ) ? 1 : -1 ];
+typedef char TaskSetDemandBoundExceeded[ ( TASK_SET_DENSITY_PPM <= 1000000ULL ) ? 1 : -1 ];
+typedef char TaskSetPeriodMaxBelowPeriod[ ( ( 0 TASK_SET( TASK_SET_ELASTIC ) ) == 0 ) ? 1 : -1 ];
+
+/*-----------------------------------------------------------
+ * Limited preemption, see configUSE_EDF_LIMITED_PREEMPTION in edf.h.
+ *
+ * A job can be held back by one non-preemptive region of a task with a later
+ * deadline.  Taking the longest region of the set for that blocking, the set
+ * stays schedulable if for every task the density plus the blocking over its
+ * deadline does not exceed 1.
+ *----------------------------------------------------------*/
+
+/* The size of a union is the size of its largest member. */
+#define TASK_SET_NPR_MEMBER( function, name, stack, period, deadline, wcet, wcet_hi, value, period_max, elasticity, npr, threshold, skip_m, skip_k )	char function##_Npr[ ( npr ) + 1 ];
+typedef union { TASK_SET( TASK_SET_NPR_MEMBER ) } TaskSetNprMax_t;
+#define TASK_SET_NPR_MAX	( ( unsigned long long ) sizeof( TaskSetNprMax_t ) - 1ULL )
+
+/* An enum, so the density can be used inside the expansion of TASK_SET(). */
+enum { TASK_SET_DENSITY_ENUM_PPM = ( int ) TASK_SET_DENSITY_PPM };
+
+#define TASK_SET_BLOCKED( function, name, stack, period, deadline, wcet, wcet_hi, value, period_max, elasticity, npr, threshold, skip_m, skip_k )	\
+	+ ( ( ( unsigned long long ) TASK_SET_DENSITY_ENUM_PPM + ( TASK_SET_NPR_MAX * 1000000ULL + ( deadline ) - 1ULL ) / ( deadline ) ) <= 1000000ULL ? 0 : 1 )
+
+typedef char TaskSetNonPreemptiveBlocking[ ( ( 0 TASK_SET( TASK_SET_BLOCKED ) ) == 0 ) ? 1 : -1 ];
+
+/*-----------------------------------------------------------
+ * Preemption thresholds, see configUSE_EDF_PREEMPTION_THRESHOLD in edf.h.
+ *
+ * Once a job of a task with a threshold runs, it completes ahead of the jobs
+ * of every task whose deadline is at least the threshold.  It blocks them for
+ * up to its wcet, which over their deadlines is at most wcet / threshold.  The
+ * set stays schedulable if the density plus that does not exceed 1 for every
+ * task with a threshold.
+ *
+ * The shorter the threshold, the fewer the tasks that preempt the job, and
+ * the larger the group of tasks that never preempt each other and could share
+ * a stack.  A threshold of -1 in the table is replaced by the shortest one
+ * that passes the check, wcet / ( 1 - density ) rounded up, or by 0 if even
+ * the deadline does not pass.
+ *----------------------------------------------------------*/
+
+#define TASK_SET_THRESHOLD_AUTO		( -1 )
+
+/* Share of the processor the density leaves for the blocking. */
+#define TASK_SET_THRESHOLD_ROOM_PPM	\
+	( ( TASK_SET_DENSITY_ENUM_PPM < 1000000 ) ? ( 1000000ULL - ( unsigned long long ) TASK_SET_DENSITY_ENUM_PPM ) : 0ULL )
+
+/* Shortest threshold in ticks whose share of wcet fits in the room, at least 1. */
+#define TASK_SET_SHORTEST_THRESHOLD( wcet )	\
+	( ( ( ( unsigned long long ) ( wcet ) * 1000000ULL + TASK_SET_THRESHOLD_ROOM_PPM * TASK_SET_US_PER_TICK - 1ULL ) / ( TASK_SET_THRESHOLD_ROOM_PPM * TASK_SET_US_PER_TICK ) ) + ( ( wcet ) == 0 ) )
+
+/* Threshold of a task in ticks, with -1 replaced. */
+#define TASK_SET_THRESHOLD_TICKS( threshold, wcet, deadline )													\
+	( ( ( threshold ) != TASK_SET_THRESHOLD_AUTO ) ? ( unsigned long long ) ( threshold ) :						\
+	  ( ( TASK_SET_THRESHOLD_ROOM_PPM == 0ULL ) || ( TASK_SET_SHORTEST_THRESHOLD( wcet ) > ( deadline ) ) ) ? 0ULL :	\
+	  TASK_SET_SHORTEST_THRESHOLD( wcet ) )
+
+/* Threshold of each task, to look up with the debugger, named <function>_Threshold. */
+#define TASK_SET_THRESHOLD( function, name, stack, period, deadline, wcet, wcet_hi, value, period_max, elasticity, npr, threshold, skip_m, skip_k )	\
+	function##_Threshold = ( int ) TASK_SET_THRESHOLD_TICKS( threshold, wcet, deadline ),
+enum { TASK_SET( TASK_SET_THRESHOLD ) TASK_SET_THRESHOLD_END };
+
+#define TASK_SET_THRESHOLD_RANGE( function, name, stack, period, deadline, wcet, wcet_hi, value, period_max, elasticity, npr, threshold, skip_m, skip_k )	\
+	+ ( ( ( ( threshold ) >= 0 ) || ( ( threshold ) == TASK_SET_THRESHOLD_AUTO ) ) && ( function##_Threshold <= ( deadline ) ) ? 0 : 1 )
+#define TASK_SET_THRESHOLD_BLOCKED( function, name, stack, period, deadline, wcet, wcet_hi, value, period_max, elasticity, npr, threshold, skip_m, skip_k )	\
+	+ ( ( function##_Threshold == 0 ) || ( ( unsigned long long ) TASK_SET_DENSITY_ENUM_PPM + TASK_SET_SHARE_PPM( wcet, function##_Threshold + ( function##_Threshold == 0 ) ) <= 1000000ULL ) ? 0 : 1 )
+
+typedef char TaskSetThresholdAboveDeadline[ ( ( 0 TASK_SET( TASK_SET_THRESHOLD_RANGE ) ) == 0 ) ? 1 : -1 ];
+typedef char TaskSetThresholdBlocking[ ( ( 0 TASK_SET( TASK_SET_THRESHOLD_BLOCKED ) ) == 0 ) ? 1 : -1 ];
+
+/*-----------------------------------------------------------
+ * (m,k)-firm tasks, see configUSE_EDF_FIRM in edf.h.
+ *
+ * The kernel keeps the last skip_k - 1 outcomes of each firm task in a 32 bit
+ * word.  Skipping never makes the task set harder to schedule, so the checks
+ * above still hold with every job run.
+ *----------------------------------------------------------*/
+
+#define TASK_SET_FIRM_RANGE( function, name, stack, period, deadline, wcet, wcet_hi, value, period_max, elasticity, npr, threshold, skip_m, skip_k )	\
+	+ ( ( ( ( skip_k ) == 0 ) && ( ( skip_m ) == 0 ) ) || ( ( ( skip_m ) < ( skip_k ) ) && ( ( skip_k ) <= 32 ) ) ? 0 : 1 )
+
+typedef char TaskSetFirmWindow[ ( ( 0 TASK_SET( TASK_SET_FIRM_RANGE ) ) == 0 ) ? 1 : -1 ];
+
+/*-----------------------------------------------------------
+ * EDF-VD, see configUSE_EDF_MIXED_CRITICALITY in edf.h.
+ *
+ * The densities of the LO tasks and of the HI tasks with their LO and HI
+ * budgets give the factor x the deadlines of the HI tasks are scaled by in LO
+ * mode.  The set is schedulable in both modes if x * LO + HI(HI) <= 1.  With
+ * deadlines equal to periods these are the utilizations of EDF-VD.
+ *----------------------------------------------------------*/
+
+#define TASK_SET_LO_DENSITY( function, name, stack, period, deadline, wcet, wcet_hi, value, period_max, elasticity, npr, threshold, skip_m, skip_k )		+ ( ( wcet_hi ) == 0 ? TASK_SET_SHARE_PPM( wcet, deadline ) : 0ULL )
+#define TASK_SET_HI_DENSITY_LO( function, name, stack, period, deadline, wcet, wcet_hi, value, period_max, elasticity, npr, threshold, skip_m, skip_k )		+ ( ( wcet_hi ) != 0 ? TASK_SET_SHARE_PPM( wcet, deadline ) : 0ULL )
+#define TASK_SET_HI_DENSITY_HI( function, name, stack, period, deadline, wcet, wcet_hi, value, period_max, elasticity, npr, threshold, skip_m, skip_k )		+ ( ( wcet_hi ) != 0 ? TASK_SET_SHARE_PPM( wcet_hi, deadline ) : 0ULL )
+#define TASK_SET_HI_ROUNDING( function, name, stack, period, deadline, wcet, wcet_hi, value, period_max, elasticity, npr, threshold, skip_m, skip_k )		+ ( ( wcet_hi ) != 0 ? ( 1000000ULL + ( deadline ) - 1ULL ) / ( deadline ) : 0ULL )
+
+#define TASK_SET_LO_DENSITY_PPM		( 0ULL TASK_SET( TASK_SET_LO_DENSITY ) )
+#define TASK_SET_HI_DENSITY_LO_PPM	( 0ULL TASK_SET( TASK_SET_HI_DENSITY_LO ) )
+#define TASK_SET_HI_DENSITY_HI_PPM	( 0ULL TASK_SET( TASK_SET_HI_DENSITY_HI ) )
+
+/* x = HI(LO) / ( 1 - LO ), rounded up.  Above 1 when the LO tasks leave no
+ * room.  An enum, so TASK_SET_VIRTUAL_DEADLINE() can be used inside the
+ * expansion of TASK_SET(). */
+enum
+{
+	TASK_SET_VD_FACTOR_PPM = ( int ) ( ( TASK_SET_LO_DENSITY_PPM < 1000000ULL ) ?
+									   ( ( TASK_SET_HI_DENSITY_LO_PPM * 1000000ULL + ( 1000000ULL - TASK_SET_LO_DENSITY_PPM ) - 1ULL ) / ( 1000000ULL - TASK_SET_LO_DENSITY_PPM ) ) :
+									   1000001ULL )
+};
+
+/* Virtual deadline of a HI task in ticks.  Rounded up to whole ticks, which
+ * raises the factor of each task by less than a tick over its deadline, so the
+ * check below adds that much for every HI task. */
+#define TASK_SET_VIRTUAL_DEADLINE( deadline )	\
+	( ( TickType_t ) ( ( ( unsigned long long ) ( deadline ) * ( unsigned long long ) TASK_SET_VD_FACTOR_PPM + 999999ULL ) / 1000000ULL ) )
+
+#define TASK_SET_VD_FACTOR_ROUNDED_PPM	( ( unsigned long long ) TASK_SET_VD_FACTOR_PPM + ( 0ULL TASK_SET( TASK_SET_HI_ROUNDING ) ) )
+
+typedef char TaskSetVirtualDeadlineAboveDeadline[ ( TASK_SET_VD_FACTOR_PPM <= 1000000ULL ) ? 1 : -1 ];
+typedef char TaskSetHighCriticalityOverload[ ( ( ( TASK_SET_VD_FACTOR_ROUNDED_PPM * TASK_SET_LO_DENSITY_PPM + 999999ULL ) / 1000000ULL ) + TASK_SET_HI_DENSITY_HI_PPM <= 1000000ULL ) ? 1 : -1 ];
+
+#endif /* TASK_SET_H */
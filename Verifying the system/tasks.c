@@ -40,6 +40,7 @@
 #include "task.h"
 #include "timers.h"
 #include "stack_macros.h"
+#include "edf.h"
 
 /* Lint e9021, e961 and e750 are suppressed as a MISRA exception justified
  * because the MPU ports require MPU_WRAPPERS_INCLUDED_FROM_API_FILE to be defined
@@ -115,6 +116,18 @@
     #define configIDLE_TASK_NAME    "IDLE"
 #endif
 
+/* E.C. : the clock used to time stamp jobs.  Defaults to the tick count, define
+ * configEDF_TIMESTAMP() in FreeRTOSConfig.h to use a free running hardware
+ * timer with a finer resolution.  Must be cheap to read from the tick ISR. */
+#ifndef configEDF_TIMESTAMP
+    #define configEDF_TIMESTAMP()    ( ( uint32_t ) xTickCount )
+#endif
+
+/* E.C. : values of the ucJobState member of the TCB. */
+#define taskEDF_JOB_COMPLETED    ( ( uint8_t ) 0 ) /* Waiting for the next release. */
+#define taskEDF_JOB_RELEASED     ( ( uint8_t ) 1 ) /* Ready, not yet dispatched. */
+#define taskEDF_JOB_STARTED      ( ( uint8_t ) 2 ) /* Dispatched at least once. */
+
 #if ( configUSE_PORT_OPTIMISED_TASK_SELECTION == 0 )
 
 /* If configUSE_PORT_OPTIMISED_TASK_SELECTION is 0 then task selection is
@@ -228,11 +241,278 @@
 		taskRECORD_READY_PRIORITY( ( pxTCB )->uxPriority );                                                \
 		listINSERT_END( &( pxReadyTasksLists[ ( pxTCB )->uxPriority ] ), &( ( pxTCB )->xStateListItem ) ); \
 		tracePOST_MOVED_TASK_TO_READY_STATE( pxTCB )
+#elif ( configUSE_EDF_BAND == 0 )
+	/* E.C. : the state list item value is also used as the wake time while the
+	 * task is delayed, so the deadline is restored from the TCB on the way back
+	 * into the ready list.  This keeps the deadline of a task that is readied
+	 * by an event, not by the tick. */
+	#define prvAddTaskToReadyList( pxTCB )                                                   \
+	traceMOVED_TASK_TO_READY_STATE(pxTCB);                                                  \
+	listSET_LIST_ITEM_VALUE( &( ( pxTCB )->xStateListItem ), ( pxTCB )->xTaskDeadline );    \
+	vListInsert( &(xReadyTasksListEDF), &( ( pxTCB )->xStateListItem ) );
+
+#else
+	/* E.C. : with an EDF band only the ready list of the band is kept in
+	 * deadline order, the other priorities keep their FIFO ready lists. */
+	#define prvAddTaskToReadyList( pxTCB )                                                           \
+	traceMOVED_TASK_TO_READY_STATE( pxTCB );                                                        \
+	taskRECORD_READY_PRIORITY( ( pxTCB )->uxPriority );                                             \
+	if( ( pxTCB )->uxPriority == ( UBaseType_t ) configEDF_BAND_PRIORITY )                          \
+	{                                                                                               \
+		listSET_LIST_ITEM_VALUE( &( ( pxTCB )->xStateListItem ), ( pxTCB )->xTaskDeadline );        \
+		vListInsert( &( xReadyTasksListEDF ), &( ( pxTCB )->xStateListItem ) );                     \
+	}                                                                                               \
+	else                                                                                            \
+	{                                                                                               \
+		listINSERT_END( &( pxReadyTasksLists[ ( pxTCB )->uxPriority ] ), &( ( pxTCB )->xStateListItem ) ); \
+	}                                                                                               \
+	tracePOST_MOVED_TASK_TO_READY_STATE( pxTCB )
+
+#endif
+
+/*
+ * E.C. : does the newly readied pxTCB preempt the running task.  Under EDF the
+ * earlier deadline does.  With an EDF band a higher priority always does, and
+ * the deadlines are only compared when both tasks are in the band.
+ */
+#if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_BAND == 0 ) )
+    #define taskEDF_PREEMPTS( pxTCB ) \
+    ( ( BaseType_t ) ( ( pxTCB )->xTaskDeadline - pxCurrentTCB->xTaskDeadline ) < 0 )
+#elif ( configUSE_EDF_SCHEDULER == 1 )
+    #define taskEDF_PREEMPTS( pxTCB )                                                               \
+    ( ( ( pxTCB )->uxPriority > pxCurrentTCB->uxPriority ) ||                                       \
+      ( ( ( pxTCB )->uxPriority == pxCurrentTCB->uxPriority ) &&                                    \
+        ( ( ( pxTCB )->uxPriority != ( UBaseType_t ) configEDF_BAND_PRIORITY ) ||                   \
+          ( ( BaseType_t ) ( ( pxTCB )->xTaskDeadline - pxCurrentTCB->xTaskDeadline ) < 0 ) ) ) )
+#endif
+
+/*
+ * E.C. : Time stamp the release and the first dispatch of a job.  A task only
+ * gets a new job when it leaves vTaskDelayUntil(), being readied for any other
+ * reason (a queue timeout for example) is not a release.
+ */
+#if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_JOB_STATS == 1 ) )
+    #define taskEDF_RECORD_JOB_RELEASE( pxTCB )                     \
+    {                                                               \
+        if( ( pxTCB )->ucJobState == taskEDF_JOB_COMPLETED )        \
+        {                                                           \
+            ( pxTCB )->ulJobReleaseTime = configEDF_TIMESTAMP();    \
+            ( pxTCB )->ucJobState = taskEDF_JOB_RELEASED;           \
+        }                                                           \
+    }
+
+    #define taskEDF_RECORD_JOB_START()                                  \
+    {                                                                   \
+        if( pxCurrentTCB->ucJobState == taskEDF_JOB_RELEASED )          \
+        {                                                               \
+            pxCurrentTCB->ulJobStartTime = configEDF_TIMESTAMP();       \
+            pxCurrentTCB->ucJobState = taskEDF_JOB_STARTED;             \
+        }                                                               \
+    }
+#else
+    #define taskEDF_RECORD_JOB_RELEASE( pxTCB )
+    #define taskEDF_RECORD_JOB_START()
+#endif
+
+/*
+ * E.C. : Give the job of pxTCB released at xReleaseTime its absolute deadline,
+ * which is also the key the task is sorted on in the EDF ready list.
+ */
+#if ( configUSE_EDF_SCHEDULER == 1 )
+    #define taskEDF_SET_DEADLINE( pxTCB, xReleaseTime )                                          \
+    {                                                                                            \
+        ( pxTCB )->xTaskDeadline = taskEDF_RELEASE_DEADLINE( pxTCB, xReleaseTime );              \
+        taskEDF_VIRTUAL_DEADLINE( pxTCB );                                                       \
+        taskEDF_SOFT_DEADLINE( pxTCB );                                                          \
+        listSET_LIST_ITEM_VALUE( &( ( pxTCB )->xStateListItem ), ( pxTCB )->xTaskDeadline );     \
+        taskEDF_NEW_JOB( pxTCB );                                                                \
+        taskEDF_DVS_RELEASE( pxTCB );                                                            \
+        taskEDF_RELEASE_THRESHOLD( pxTCB );                                                      \
+    }
+#endif
+
+/*
+ * E.C. : In LO mode the job of a HI task that has just been given its deadline
+ * runs to its virtual deadline instead, see configUSE_EDF_MIXED_CRITICALITY.
+ * taskEDF_REAL_DEADLINE() is the deadline the job is judged by either way.
+ */
+#if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_MIXED_CRITICALITY == 1 ) )
+    #define taskEDF_VIRTUAL_DEADLINE( pxTCB )                                                               \
+    {                                                                                                       \
+        if( ( xEDFCriticalityMode == edfCRITICALITY_LO ) && ( ( pxTCB )->xTaskBudgetHigh != ( TickType_t ) 0U ) ) \
+        {                                                                                                   \
+            ( pxTCB )->xTaskDeadline -= ( pxTCB )->xTaskRelativeDeadline - ( pxTCB )->xTaskVirtualDeadline; \
+            ( pxTCB )->ucVirtualDeadline = pdTRUE;                                                          \
+        }                                                                                                   \
+        else                                                                                                \
+        {                                                                                                   \
+            ( pxTCB )->ucVirtualDeadline = pdFALSE;                                                         \
+        }                                                                                                   \
+    }
+
+    #define taskEDF_REAL_DEADLINE( pxTCB )                                                                  \
+    ( ( pxTCB )->xTaskDeadline +                                                                            \
+      ( ( ( pxTCB )->ucVirtualDeadline != pdFALSE ) ? ( ( pxTCB )->xTaskRelativeDeadline - ( pxTCB )->xTaskVirtualDeadline ) : ( TickType_t ) 0U ) )
+#else
+    #define taskEDF_VIRTUAL_DEADLINE( pxTCB )
+    #define taskEDF_REAL_DEADLINE( pxTCB )    ( ( pxTCB )->xTaskDeadline )
+#endif
+
+/*
+ * E.C. : The deadline of a job of pxTCB released at xReleaseTime.  The jobs of
+ * a Total Bandwidth Server queue up behind the deadline of the last one, see
+ * configUSE_EDF_TBS.
+ */
+#if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_TBS == 1 ) )
+    #define taskEDF_RELEASE_DEADLINE( pxTCB, xReleaseTime )                                  \
+    ( ( ( pxTCB )->xServerSpan == ( TickType_t ) 0U ) ?                                      \
+      ( ( xReleaseTime ) + ( pxTCB )->xTaskRelativeDeadline ) :                              \
+      ( ( ( ( BaseType_t ) ( taskEDF_REAL_DEADLINE( pxTCB ) - ( xReleaseTime ) ) > 0 ) ?     \
+          taskEDF_REAL_DEADLINE( pxTCB ) : ( xReleaseTime ) ) + ( pxTCB )->xServerSpan ) )
+#else
+    #define taskEDF_RELEASE_DEADLINE( pxTCB, xReleaseTime )    ( ( xReleaseTime ) + ( pxTCB )->xTaskRelativeDeadline )
+#endif
+
+/*
+ * E.C. : pxTCB is a hard task, whose deadlines the slack stealing protects,
+ * and a job of it is ready.
+ */
+#if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_SLACK_STEALING == 1 ) )
+    #define taskEDF_IS_HARD( pxTCB ) \
+    ( ( ( pxTCB )->ucSoft == pdFALSE ) && ( ( pxTCB )->xTaskBudget != ( TickType_t ) 0U ) )
+
+    #define taskEDF_IS_READY( pxTCB ) \
+    ( listIS_CONTAINED_WITHIN( &( xReadyTasksListEDF ), &( ( pxTCB )->xStateListItem ) ) != pdFALSE )
+#endif
+
+/*
+ * E.C. : A job completed, was shed or was released sporadically, any of which
+ * can give the hard tasks slack back, so it is worked out again at the next
+ * tick.
+ */
+#if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_SLACK_STEALING == 1 ) )
+    #define taskEDF_SLACK_STALE()    ( xEDFSlackStale = pdTRUE )
+#else
+    #define taskEDF_SLACK_STALE()
+#endif
+
+/*
+ * E.C. : A job of a soft task is released behind every hard job the slack is
+ * looked for, the next tick moves it to where the slack allows, see
+ * configUSE_EDF_SLACK_STEALING.
+ */
+#if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_SLACK_STEALING == 1 ) )
+    #define taskEDF_SOFT_DEADLINE( pxTCB )                                       \
+    {                                                                            \
+        if( ( pxTCB )->ucSoft != pdFALSE )                                       \
+        {                                                                        \
+            ( pxTCB )->xTaskDeadline = xTickCount + configEDF_SLACK_HORIZON;     \
+        }                                                                        \
+    }
+#else
+    #define taskEDF_SOFT_DEADLINE( pxTCB )
+#endif
+
+/*
+ * E.C. : A released job of pxTCB can be shed if it has not been dispatched, so
+ * the task is still in vTaskDelayUntil(), and its next release is still ahead.
+ */
+#if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_OVERLOAD == 1 ) )
+    #define taskEDF_CAN_SHED( pxTCB )                    \
+    ( ( ( pxTCB )->pxTaskWakeTime != NULL ) &&           \
+      ( ( BaseType_t ) ( ( *( ( pxTCB )->pxTaskWakeTime ) + ( pxTCB )->xTaskPeriod ) - xTickCount ) > 0 ) )
+#endif
+
+/*
+ * E.C. : pxTCB is (m,k)-firm, and can skip its next job without skipping more
+ * than m in k, see configUSE_EDF_FIRM.  A task that is not firm can always be
+ * shed.
+ */
+#if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_FIRM == 1 ) )
+    #define taskEDF_IS_FIRM( pxTCB )          ( ( pxTCB )->uxFirmWindow != ( UBaseType_t ) 0U )
+    #define taskEDF_FIRM_CAN_SKIP( pxTCB )    ( ( ( pxTCB )->uxFirmWindow == ( UBaseType_t ) 0U ) || ( ( pxTCB )->uxFirmSkipped < ( pxTCB )->uxFirmMaxSkipped ) )
+#else
+    #define taskEDF_IS_FIRM( pxTCB )          pdFALSE
+    #define taskEDF_FIRM_CAN_SKIP( pxTCB )    pdTRUE
+#endif
+
+/*
+ * E.C. : Start counting the ticks the new job of pxTCB runs for, the overload
+ * check compares what is left of its budget with its deadline.
+ */
+#if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_OVERLOAD == 1 ) )
+    #define taskEDF_NEW_JOB( pxTCB )    ( ( pxTCB )->xJobExecuted = ( TickType_t ) 0U )
+#else
+    #define taskEDF_NEW_JOB( pxTCB )
+#endif
+
+/*
+ * E.C. : A new job of pxTCB counts for its whole budget until it completes,
+ * see configUSE_EDF_DVS.
+ */
+#if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_DVS == 1 ) )
+    #define taskEDF_DVS_RELEASE( pxTCB )    prvEDFDVSRelease( pxTCB )
+#else
+    #define taskEDF_DVS_RELEASE( pxTCB )
+#endif
+
+/*
+ * E.C. : The running job is inside its non-preemptive region.
+ * taskEDF_DEFER_PREEMPTION() holds back a preemption of the running job while
+ * it is, and is pdTRUE if it did.
+ */
+#if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_LIMITED_PREEMPTION == 1 ) )
+    #define taskEDF_IN_NON_PREEMPTIVE_REGION()    ( xEDFRegionExecuted < pxCurrentTCB->xTaskNonPreemptive )
+    #define taskEDF_DEFER_PREEMPTION()            prvEDFDeferPreemption()
+#else
+    #define taskEDF_DEFER_PREEMPTION()            pdFALSE
+#endif
+
+/*
+ * E.C. : The released job of pxTCB is above the system ceiling, the shortest
+ * threshold of the jobs that have started and not completed, or is one of
+ * them.  Outside the EDF band priorities decide, not thresholds.
+ *
+ * taskEDF_HOLD_THRESHOLD() is used when a job of the running task starts, and
+ * taskEDF_RELEASE_THRESHOLD() when pxTCB is given a new job.
+ */
+#if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_PREEMPTION_THRESHOLD == 1 ) )
+    #define taskEDF_ABOVE_THRESHOLD( pxTCB )                                  \
+    ( ( xEDFSystemCeiling == ( TickType_t ) 0U ) ||                           \
+      ( ( pxTCB )->xTaskRelativeDeadline < xEDFSystemCeiling ) ||             \
+      ( ( pxTCB )->xThresholdHeld != pdFALSE ) ||                             \
+      ( ( pxTCB )->uxPriority != pxCurrentTCB->uxPriority ) )
+
+    #define taskEDF_HOLD_THRESHOLD()                                          \
+    {                                                                         \
+        if( pxCurrentTCB->xTaskThreshold != ( TickType_t ) 0U )               \
+        {                                                                     \
+            pxCurrentTCB->xThresholdHeld = pdTRUE;                            \
+                                                                              \
+            if( ( xEDFSystemCeiling == ( TickType_t ) 0U ) ||                 \
+                ( pxCurrentTCB->xTaskThreshold < xEDFSystemCeiling ) )        \
+            {                                                                 \
+                xEDFSystemCeiling = pxCurrentTCB->xTaskThreshold;             \
+            }                                                                 \
+        }                                                                     \
+    }
+
+    #define taskEDF_RELEASE_THRESHOLD( pxTCB )    ( ( pxTCB )->xThresholdHeld = pdFALSE )
 #else
-	#define prvAddTaskToReadyList( pxTCB ) /*xGenericListIteam must contain thedeadline value */ \
-	traceMOVED_TASK_TO_READY_STATE(pxTCB);														 \
-	vListInsert( &(xReadyTasksListEDF), &( ( pxTCB )->xStateListItem ) );						 
+    #define taskEDF_ABOVE_THRESHOLD( pxTCB )    pdTRUE
+    #define taskEDF_HOLD_THRESHOLD()
+    #define taskEDF_RELEASE_THRESHOLD( pxTCB )
+#endif
 
+/*
+ * E.C. : The period of pxTCB can still be stretched by xTaskEDFElasticAdapt(),
+ * it is elastic, has a budget and has not reached its longest period.
+ */
+#if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_ELASTIC == 1 ) )
+    #define taskEDF_CAN_STRETCH( pxTCB )                             \
+    ( ( ( pxTCB )->uxElasticity != ( UBaseType_t ) 0U ) &&           \
+      ( ( pxTCB )->xTaskBudget != ( TickType_t ) 0U ) &&             \
+      ( ( pxTCB )->xTaskPeriodNext != ( pxTCB )->xTaskPeriodMax ) )
 #endif
 
 /*-----------------------------------------------------------*/
@@ -346,6 +626,95 @@ typedef struct tskTaskControlBlock       /* The old naming convention is used to
 	/* E.C. : the period of a task */
 	#if ( configUSE_EDF_SCHEDULER == 1 )
 		TickType_t xTaskPeriod; 												/*< Stores the period in tick of the task. > */
+		TickType_t xTaskRelativeDeadline;										/*< Deadline of each job relative to its release, defaults to the period. */
+		TickType_t xTaskDeadline;												/*< Absolute deadline of the current job, or of the last one while blocked. */
+		TickType_t xTaskBudget;													/*< Declared worst case execution time in ticks, 0 if unknown. */
+		uint32_t ulDeadlineMisses;												/*< Number of jobs that completed after their deadline. */
+	#endif
+
+	/* E.C. : time stamps of the current job and the statistics of the completed ones. */
+	#if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_JOB_STATS == 1 ) )
+		uint8_t ucJobState;            /*< One of the taskEDF_JOB_* values. */
+		uint32_t ulJobReleaseTime;     /*< configEDF_TIMESTAMP() when the current job was released. */
+		uint32_t ulJobStartTime;       /*< configEDF_TIMESTAMP() when the current job was first dispatched. */
+		uint64_t ullResponseSum;       /*< Sum of the response times, used to compute the mean. */
+		uint64_t ullStartLatencySum;   /*< Sum of the start latencies, used to compute the mean. */
+		EDFJobStats_t xJobStats;       /*< Min, max and histogram; the means are filled in by vTaskGetJobStats(). */
+	#endif
+
+	/* E.C. : run time accounting, see configUSE_EDF_UTILIZATION. */
+	#if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_UTILIZATION == 1 ) )
+		uint64_t ullRunTime;            /*< Time spent in the Running state, in configEDF_TIMESTAMP() units.  64 bits so it never wraps in practice. */
+		uint64_t ullWindowStartRunTime; /*< ullRunTime when the task first ran in window ulWindowNumber. */
+		uint32_t ulLastWindowRunTime;   /*< Run time in the window before ulWindowNumber. */
+		uint32_t ulWindowNumber;        /*< Utilization window the task last ran in. */
+	#endif
+
+	/* E.C. : overload management, see configUSE_EDF_OVERLOAD. */
+	#if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_OVERLOAD == 1 ) )
+		TickType_t xJobExecuted;        /*< Ticks the current job has been running for. */
+		UBaseType_t uxTaskValue;        /*< Value of each job under overload, 0 if never shed. */
+		TickType_t * pxTaskWakeTime;    /*< Wake time passed to vTaskDelayUntil() while a released job has not started, NULL otherwise. */
+		uint32_t ulJobsShed;            /*< Number of jobs shed under overload. */
+	#endif
+
+	/* E.C. : (m,k)-firm tasks, see configUSE_EDF_FIRM. */
+	#if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_FIRM == 1 ) )
+		UBaseType_t uxFirmMaxSkipped;   /*< m, jobs that can be skipped in any uxFirmWindow in a row. */
+		UBaseType_t uxFirmWindow;       /*< k, 0 if the task is not firm. */
+		UBaseType_t uxFirmSkipped;      /*< Jobs skipped or late among the last uxFirmWindow - 1. */
+		uint32_t ulFirmHistory;         /*< Last uxFirmWindow - 1 outcomes, bit 0 the latest, set if skipped or late. */
+	#endif
+
+	/* E.C. : EDF-VD, see configUSE_EDF_MIXED_CRITICALITY. */
+	#if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_MIXED_CRITICALITY == 1 ) )
+		TickType_t xTaskBudgetHigh;     /*< Worst case execution time in HI mode, 0 for a task of LO criticality. */
+		TickType_t xTaskVirtualDeadline; /*< Deadline of each job relative to its release in LO mode. */
+		uint8_t ucVirtualDeadline;      /*< pdTRUE if xTaskDeadline is the virtual deadline of the current job. */
+	#endif
+
+	/* E.C. : elastic periods, see configUSE_EDF_ELASTIC. */
+	#if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_ELASTIC == 1 ) )
+		TickType_t xTaskPeriodMin;      /*< Nominal period, the one the task was created with. */
+		TickType_t xTaskPeriodMax;      /*< Longest period the task accepts, 0 if the task is not elastic. */
+		TickType_t xTaskPeriodNext;     /*< Period from the next release on, as set by xTaskEDFElasticAdapt(). */
+		UBaseType_t uxElasticity;       /*< Share of the compression the task takes, 0 to keep its period. */
+		struct tskTaskControlBlock * pxNextElastic; /*< Next task registered with vTaskSetEDFElastic(). */
+	#endif
+
+	/* E.C. : mode changes, see configUSE_EDF_MODES. */
+	#if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_MODES == 1 ) )
+		TickType_t * pxTaskLastWakeTime; /*< Wake time last passed to vTaskDelayUntil(), NULL if the task never called it. */
+	#endif
+
+	/* E.C. : limited preemption, see configUSE_EDF_LIMITED_PREEMPTION. */
+	#if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_LIMITED_PREEMPTION == 1 ) )
+		TickType_t xTaskNonPreemptive;  /*< Length of the non-preemptive regions in ticks, 0 if the task can always be preempted. */
+	#endif
+
+	/* E.C. : preemption threshold, see configUSE_EDF_PREEMPTION_THRESHOLD. */
+	#if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_PREEMPTION_THRESHOLD == 1 ) )
+		TickType_t xTaskThreshold;      /*< Only tasks with a shorter relative deadline preempt a running job, 0 for plain EDF. */
+		BaseType_t xThresholdHeld;      /*< pdTRUE once the current job has started, until the next one is released. */
+	#endif
+
+	/* E.C. : slack stealing, see configUSE_EDF_SLACK_STEALING. */
+	#if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( ( configUSE_EDF_SLACK_STEALING == 1 ) || ( configUSE_EDF_DVS == 1 ) ) )
+		struct tskTaskControlBlock * pxNextPeriodic; /*< Next task created with xTaskPeriodicCreate(). */
+	#endif
+	#if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_SLACK_STEALING == 1 ) )
+		uint8_t ucSoft;                 /*< pdTRUE if the jobs of the task run in the slack of the hard tasks. */
+	#endif
+
+	/* E.C. : Total Bandwidth Server, see configUSE_EDF_TBS. */
+	#if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_TBS == 1 ) )
+		TickType_t xServerSpan;         /*< C / Us of the server in ticks, 0 if the task is not a server. */
+	#endif
+
+	/* E.C. : cycle-conserving EDF, see configUSE_EDF_DVS. */
+	#if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_DVS == 1 ) )
+		uint32_t ulDVSShare;            /*< Share of the processor the task counts for, in parts per million. */
+		uint64_t ullDVSWork;            /*< Work of the current job, in millionths of a tick at full speed. */
 	#endif
 
 } tskTCB;
@@ -354,6 +723,13 @@ typedef struct tskTaskControlBlock       /* The old naming convention is used to
  * below to enable the use of older kernel aware debuggers. */
 typedef tskTCB TCB_t;
 
+/* E.C. : StaticEDFTask_t mirrors the EDF members appended to the TCB and must
+ * be large enough to hold one.  An array of negative size stops the build if
+ * the two have drifted apart. */
+#if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 1 ) )
+    typedef char taskEDF_STATIC_TCB_TOO_SMALL[ ( sizeof( StaticEDFTask_t ) >= sizeof( TCB_t ) ) ? 1 : -1 ];
+#endif
+
 /*lint -save -e956 A manual analysis and inspection has been used to determine
  * which static variables must be declared volatile. */
 PRIVILEGED_DATA TCB_t * volatile pxCurrentTCB = NULL;
@@ -371,9 +747,73 @@ PRIVILEGED_DATA static List_t xPendingReadyList;                         /*< Tas
 
 /////////////////////////////////////**************/////////////////////////////////////
 /* E.C. : the new RedyList */
-#if ( configUSE_EDF_SCHEDULER == 1 )
+#if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_BAND == 0 ) )
 	PRIVILEGED_DATA static List_t xReadyTasksListEDF; /*< Ready tasks ordered by their deadline. */
 	/*by their deadline. */
+#elif ( configUSE_EDF_SCHEDULER == 1 )
+	/* E.C. : the band is scheduled from its own priority's ready list, kept in
+	 * deadline order, so the fixed priority selection finds it as usual. */
+	#define xReadyTasksListEDF    pxReadyTasksLists[ configEDF_BAND_PRIORITY ]
+#endif
+
+/* E.C. : criticality mode of EDF-VD. */
+#if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_MIXED_CRITICALITY == 1 ) )
+	PRIVILEGED_DATA static volatile BaseType_t xEDFCriticalityMode = edfCRITICALITY_LO;
+#endif
+
+/* E.C. : tasks registered with vTaskSetEDFElastic(). */
+#if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_ELASTIC == 1 ) )
+	PRIVILEGED_DATA static TCB_t * pxEDFElasticTasks = NULL;
+#endif
+
+/* E.C. : mode change waiting for the idle task. */
+#if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_MODES == 1 ) )
+	PRIVILEGED_DATA static const EDFModeChange_t * volatile pxEDFModeChange = NULL;
+#endif
+
+/* E.C. : non-preemptive region of the running task.  Only the running task
+ * can be inside one, so the region is kept here rather than in each TCB. */
+#if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_LIMITED_PREEMPTION == 1 ) )
+	PRIVILEGED_DATA static TCB_t * pxEDFRegionTCB = NULL;                           /*< Task the region belongs to. */
+	PRIVILEGED_DATA static TickType_t xEDFRegionExecuted = ( TickType_t ) 0U;       /*< Ticks the region has been running for. */
+	PRIVILEGED_DATA static volatile BaseType_t xEDFPreemptionDeferred = pdFALSE;    /*< pdTRUE if a preemption waits for the region to end. */
+#endif
+
+/* E.C. : system ceiling of the preemption thresholds, the shortest threshold
+ * of the ready jobs that have started, 0 if there is none.  Worked out again
+ * at every dispatch. */
+#if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_PREEMPTION_THRESHOLD == 1 ) )
+	PRIVILEGED_DATA static TickType_t xEDFSystemCeiling = ( TickType_t ) 0U;
+#endif
+
+/* E.C. : every periodic task, the hard tasks whose slack is stolen and the
+ * soft tasks that steal it, or the tasks whose shares make up the speed. */
+#if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( ( configUSE_EDF_SLACK_STEALING == 1 ) || ( configUSE_EDF_DVS == 1 ) ) )
+	PRIVILEGED_DATA static TCB_t * pxEDFPeriodicTasks = NULL;
+#endif
+
+/* E.C. : slack stealing, the slack last worked out by prvEDFSlack(). */
+#if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_SLACK_STEALING == 1 ) )
+	PRIVILEGED_DATA static TickType_t xEDFSlack = ( TickType_t ) 0U;           /*< Slack at xEDFSlackTick. */
+	PRIVILEGED_DATA static TickType_t xEDFSlackTick = ( TickType_t ) 0U;       /*< Tick the slack was worked out at. */
+	PRIVILEGED_DATA static TickType_t xEDFSlackCheckpoint = ( TickType_t ) 0U; /*< Deadline with the least slack. */
+	PRIVILEGED_DATA static volatile BaseType_t xEDFSlackStale = pdTRUE;      /*< The slack has to be worked out again. */
+#endif
+
+/* E.C. : cycle-conserving EDF. */
+#if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_DVS == 1 ) )
+	PRIVILEGED_DATA static volatile uint32_t ulEDFSpeed = 1000000UL;  /*< Speed last passed to configEDF_DVS_SET_SPEED(). */
+	PRIVILEGED_DATA static volatile BaseType_t xEDFSpeedStale = pdFALSE; /*< A share changed since the speed was worked out. */
+#endif
+
+/* E.C. : utilization windows. */
+#if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_UTILIZATION == 1 ) )
+	PRIVILEGED_DATA static uint32_t ulEDFSwitchedInTime = 0UL;       /*< configEDF_TIMESTAMP() when the running task was switched in. */
+	PRIVILEGED_DATA static uint32_t ulEDFWindowNumber = 0UL;         /*< Number of the utilization window in progress. */
+	PRIVILEGED_DATA static uint32_t ulEDFWindowStartTime = 0UL;      /*< configEDF_TIMESTAMP() when the window in progress started. */
+	PRIVILEGED_DATA static uint32_t ulEDFLastWindowLength = 0UL;     /*< Length of the last completed window, in configEDF_TIMESTAMP() units. */
+	PRIVILEGED_DATA static TickType_t xEDFWindowStartTick = ( TickType_t ) 0U;
+	PRIVILEGED_DATA static volatile uint32_t ulEDFCpuLoad = 0UL;     /*< CPU load of the last completed window, in tenths of a percent. */
 #endif
 
 #if ( INCLUDE_vTaskDelete == 1 )
@@ -553,6 +993,190 @@ static void prvAddCurrentTaskToDelayedList( TickType_t xTicksToWait,
  */
 static void prvResetNextTaskUnblockTime( void ) PRIVILEGED_FUNCTION;
 
+/*
+ * E.C. : Fill in the EDF information of a single task.  Must be called with
+ * the scheduler suspended or from a critical section.
+ */
+#if ( ( configUSE_EDF_SCHEDULER == 1 ) || ( configUSE_TRACE_FACILITY == 1 ) )
+
+    static void prvEDFGetInfo( const TCB_t * const pxTCB,
+                               EDFTaskStatus_t * pxEDFStatus ) PRIVILEGED_FUNCTION;
+
+#endif
+
+/*
+ * E.C. : Give a newly initialised TCB its period and deadline and release its
+ * first job.  Shared by the dynamic and the static periodic create functions.
+ */
+#if ( configUSE_EDF_SCHEDULER == 1 )
+
+    static void prvInitialisePeriodicTask( TCB_t * pxNewTCB,
+                                           TickType_t period ) PRIVILEGED_FUNCTION;
+
+#endif
+
+/*
+ * E.C. : Fold the job of pxTCB that has just completed into the statistics
+ * held in its TCB.  Constant time, called with the scheduler suspended.
+ */
+#if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_JOB_STATS == 1 ) )
+
+    static void prvEDFRecordJobCompletion( TCB_t * const pxTCB ) PRIVILEGED_FUNCTION;
+
+#endif
+
+/*
+ * E.C. : Shed the least valuable jobs that have not started yet until every
+ * ready job can complete by its deadline, see configUSE_EDF_OVERLOAD.  Called
+ * from the tick with the scheduler running.
+ *
+ * prvEDFShedJob() skips the job of pxTCB, which is ready but still inside
+ * vTaskDelayUntil(), and puts the task back in the delayed list until its
+ * next release.
+ */
+#if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_OVERLOAD == 1 ) )
+
+    static void prvEDFShedOverload( void ) PRIVILEGED_FUNCTION;
+    static void prvEDFShedJob( TCB_t * const pxTCB ) PRIVILEGED_FUNCTION;
+
+#endif
+
+/*
+ * E.C. : Add the outcome of the last job of the firm task pxTCB to its
+ * history, xMissed is pdTRUE if the job was skipped or completed late.
+ */
+#if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_FIRM == 1 ) )
+
+    static void prvEDFFirmRecord( TCB_t * const pxTCB,
+                                  BaseType_t xMissed ) PRIVILEGED_FUNCTION;
+
+#endif
+
+/*
+ * E.C. : Enter HI mode: the ready HI jobs get their real deadlines back and the
+ * LO jobs are shed.  prvEDFShedLowCriticality() sheds the LO jobs that are
+ * ready but have not started, in HI mode after every release.  Both are
+ * called from the tick.
+ */
+#if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_MIXED_CRITICALITY == 1 ) )
+
+    static void prvEDFSwitchToHighCriticality( void ) PRIVILEGED_FUNCTION;
+    static void prvEDFShedLowCriticality( void ) PRIVILEGED_FUNCTION;
+
+#endif
+
+/*
+ * E.C. : Share of the processor a budget of xBudget ticks every xPeriod ticks
+ * takes, in parts per million and rounded up, see configUSE_EDF_ELASTIC.
+ */
+#if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_ELASTIC == 1 ) )
+
+    static uint32_t prvEDFElasticShare( TickType_t xBudget,
+                                        TickType_t xPeriod ) PRIVILEGED_FUNCTION;
+
+#endif
+
+/*
+ * E.C. : Suspend the tasks pxChange stops and release the ones it starts, see
+ * configUSE_EDF_MODES.  Called from the idle task with the scheduler
+ * suspended, or before the scheduler starts.
+ */
+#if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_MODES == 1 ) )
+
+    static void prvEDFApplyModeChange( const EDFModeChange_t * const pxChange ) PRIVILEGED_FUNCTION;
+
+#endif
+
+/*
+ * E.C. : See taskEDF_DEFER_PREEMPTION().  Called from the tick and from
+ * interrupts.
+ */
+#if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_LIMITED_PREEMPTION == 1 ) )
+
+    static BaseType_t prvEDFDeferPreemption( void ) PRIVILEGED_FUNCTION;
+
+#endif
+
+/*
+ * E.C. : The ready job to dispatch under preemption thresholds.  The earliest
+ * deadline whose task is above the system ceiling left by the ready jobs that
+ * have started, or is one of them, see configUSE_EDF_PREEMPTION_THRESHOLD.
+ * A job that was held back by the threshold of a job it later preempted
+ * would otherwise be dispatched ahead of it.  Called from
+ * vTaskSwitchContext().
+ */
+#if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_PREEMPTION_THRESHOLD == 1 ) )
+
+    static TCB_t * prvEDFSelectAboveCeiling( void ) PRIVILEGED_FUNCTION;
+
+#endif
+
+/*
+ * E.C. : The period the idle task is created with, the longest period of the
+ * tasks created before the scheduler starts, or the longest they can be
+ * stretched to, and at least 200 ticks.  The deadline the idle task is
+ * refreshed to then never comes before that of a released job.  Called from
+ * vTaskStartScheduler().
+ */
+#if ( configUSE_EDF_SCHEDULER == 1 )
+
+    static TickType_t prvEDFIdlePeriod( void ) PRIVILEGED_FUNCTION;
+
+#endif
+
+/*
+ * E.C. : Move the ready soft jobs ahead of the hard jobs while there is
+ * slack, behind them otherwise, see configUSE_EDF_SLACK_STEALING.  Returns
+ * pdTRUE if a context switch is needed.  Called from the tick.
+ *
+ * prvEDFSlack() returns the ticks the hard jobs can be put off from now, and
+ * in pxCheckpoint the deadline with the least slack.  prvEDFHardDemand()
+ * returns the ticks of work of the hard jobs due by xDeadline.
+ * prvEDFNextRelease() returns the earliest time the job after the current or
+ * last one of pxTCB can be released.
+ */
+#if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_SLACK_STEALING == 1 ) )
+
+    static BaseType_t prvEDFStealSlack( void ) PRIVILEGED_FUNCTION;
+    static TickType_t prvEDFSlack( TickType_t * const pxCheckpoint ) PRIVILEGED_FUNCTION;
+    static TickType_t prvEDFHardDemand( TickType_t xDeadline ) PRIVILEGED_FUNCTION;
+    static TickType_t prvEDFNextRelease( const TCB_t * const pxTCB ) PRIVILEGED_FUNCTION;
+
+#endif
+
+/*
+ * E.C. : Cycle-conserving EDF, see configUSE_EDF_DVS.  prvEDFDVSRelease() and
+ * prvEDFDVSComplete() set the share of pxTCB at the release and at the
+ * completion of a job.  prvEDFDVSUpdateSpeed() sums the shares into the speed
+ * and is only called from the tick and from interrupts, so the speed is only
+ * ever set from one context at a time.
+ */
+#if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_DVS == 1 ) )
+
+    static void prvEDFDVSRelease( TCB_t * const pxTCB ) PRIVILEGED_FUNCTION;
+    static void prvEDFDVSComplete( TCB_t * const pxTCB ) PRIVILEGED_FUNCTION;
+    static void prvEDFDVSUpdateSpeed( void ) PRIVILEGED_FUNCTION;
+
+#endif
+
+/*
+ * E.C. : Charge the time since the last switch to the running task.  Only
+ * integer adds and compares, as it is called on every context switch.
+ */
+#if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_UTILIZATION == 1 ) )
+
+    static void prvEDFAccountRunTime( void ) PRIVILEGED_FUNCTION;
+
+/*
+ * E.C. : Run time of pxTCB in the last completed utilization window, and the
+ * same scaled to tenths of a percent of the window length.
+ */
+    static uint32_t prvEDFLastWindowRunTime( const TCB_t * const pxTCB ) PRIVILEGED_FUNCTION;
+    static uint32_t prvEDFPermille( uint32_t ulPart,
+                                    uint32_t ulWhole ) PRIVILEGED_FUNCTION;
+
+#endif
+
 #if ( ( configUSE_TRACE_FACILITY == 1 ) && ( configUSE_STATS_FORMATTING_FUNCTIONS > 0 ) )
 
 /*
@@ -843,7 +1467,7 @@ static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB ) PRIVILEGED_FUNCTION;
 
 /////////////////////////////////*************************************////////////////////////////////
 		/*E.C. */
-#if ( configUSE_EDF_SCHEDULER == 1 )
+#if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) )
 
     BaseType_t xTaskPeriodicCreate( TaskFunction_t pxTaskCode,
                             const char * const pcName, /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
@@ -925,12 +1549,9 @@ static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB ) PRIVILEGED_FUNCTION;
             prvInitialiseNewTask( pxTaskCode, pcName, ( uint32_t ) usStackDepth, pvParameters, uxPriority, pxCreatedTask, pxNewTCB, NULL );
        
 /////////////////////////**************************************/////////////////////////////////////					
-			/*E.C. : initialize the period */
-			pxNewTCB->xTaskPeriod = period;
-			/*E.C. : insert the period value in the generic list iteam before to add the task in RL: */
-			listSET_LIST_ITEM_VALUE( &( ( pxNewTCB )->xStateListItem ), ( pxNewTCB )->xTaskPeriod + xTaskGetTickCount() );	
-			//prvAddTaskToReadyList( pxNewTCB );
-			
+			/*E.C. : initialize the period and release the first job */
+			prvInitialisePeriodicTask( pxNewTCB, period );
+
 			prvAddNewTaskToReadyList( pxNewTCB );
             
 			xReturn = pdPASS;
@@ -943,30 +1564,108 @@ static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB ) PRIVILEGED_FUNCTION;
         return xReturn;
     }
 
-#endif /* configSUPPORT_DYNAMIC_ALLOCATION */
+#endif /* ( configUSE_EDF_SCHEDULER == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) */
 /*-----------------------------------------------------------*/
 
-static void prvInitialiseNewTask( TaskFunction_t pxTaskCode,
-                                  const char * const pcName, /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
-                                  const uint32_t ulStackDepth,
-                                  void * const pvParameters,
-                                  UBaseType_t uxPriority,
-                                  TaskHandle_t * const pxCreatedTask,
-                                  TCB_t * pxNewTCB,
-                                  const MemoryRegion_t * const xRegions )
-{
-    StackType_t * pxTopOfStack;
-    UBaseType_t x;
+		/*E.C. : same as xTaskPeriodicCreate() but the TCB and the stack are
+		 * supplied by the caller, so a periodic task never touches the heap. */
+#if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 1 ) )
+
+    TaskHandle_t xTaskPeriodicCreateStatic( TaskFunction_t pxTaskCode,
+                                            const char * const pcName, /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+                                            const uint32_t ulStackDepth,
+                                            void * const pvParameters,
+                                            UBaseType_t uxPriority,
+                                            StackType_t * const puxStackBuffer,
+                                            StaticEDFTask_t * const pxTaskBuffer,
+                                            TickType_t period )
+    {
+        TCB_t * pxNewTCB;
+        TaskHandle_t xReturn;
 
-    #if ( portUSING_MPU_WRAPPERS == 1 )
-        /* Should the task be created in privileged mode? */
-        BaseType_t xRunPrivileged;
+        configASSERT( puxStackBuffer != NULL );
+        configASSERT( pxTaskBuffer != NULL );
 
-        if( ( uxPriority & portPRIVILEGE_BIT ) != 0U )
-        {
-            xRunPrivileged = pdTRUE;
-        }
-        else
+        if( ( pxTaskBuffer != NULL ) && ( puxStackBuffer != NULL ) )
+        {
+            /* The memory used for the task's TCB and stack are passed into this
+             * function - use them. */
+            pxNewTCB = ( TCB_t * ) pxTaskBuffer; /*lint !e740 !e9087 Unusual cast is ok as the structures are designed to have the same alignment, and the size is checked at compile time. */
+            pxNewTCB->pxStack = ( StackType_t * ) puxStackBuffer;
+
+            #if ( tskSTATIC_AND_DYNAMIC_ALLOCATION_POSSIBLE != 0 ) /*lint !e731 !e9029 Macro has been consolidated for readability reasons. */
+                {
+                    /* Tasks can be created statically or dynamically, so note this
+                     * task was created statically in case the task is later deleted. */
+                    pxNewTCB->ucStaticallyAllocated = tskSTATICALLY_ALLOCATED_STACK_AND_TCB;
+                }
+            #endif /* tskSTATIC_AND_DYNAMIC_ALLOCATION_POSSIBLE */
+
+            prvInitialiseNewTask( pxTaskCode, pcName, ulStackDepth, pvParameters, uxPriority, &xReturn, pxNewTCB, NULL );
+            prvInitialisePeriodicTask( pxNewTCB, period );
+            prvAddNewTaskToReadyList( pxNewTCB );
+        }
+        else
+        {
+            xReturn = NULL;
+        }
+
+        return xReturn;
+    }
+
+#endif /* ( configUSE_EDF_SCHEDULER == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 1 ) */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_EDF_SCHEDULER == 1 )
+
+    static void prvInitialisePeriodicTask( TCB_t * pxNewTCB,
+                                           TickType_t period )
+    {
+		/*E.C. : initialize the period, the deadline defaults to the end of the period */
+		pxNewTCB->xTaskPeriod = period;
+		pxNewTCB->xTaskRelativeDeadline = period;
+		/* E.C. : the slack of the hard tasks, or the speed, is worked out from
+		 * this chain. */
+		#if ( ( configUSE_EDF_SLACK_STEALING == 1 ) || ( configUSE_EDF_DVS == 1 ) )
+		{
+			taskENTER_CRITICAL();
+			{
+				pxNewTCB->pxNextPeriodic = pxEDFPeriodicTasks;
+				pxEDFPeriodicTasks = pxNewTCB;
+			}
+			taskEXIT_CRITICAL();
+		}
+		#endif
+		/*E.C. : insert the deadline value in the generic list iteam before to add the task in RL: */
+		taskEDF_SET_DEADLINE( pxNewTCB, xTaskGetTickCount() );
+		/*E.C. : the first job is released when the task is created */
+		taskEDF_RECORD_JOB_RELEASE( pxNewTCB );
+    }
+
+#endif /* configUSE_EDF_SCHEDULER */
+/*-----------------------------------------------------------*/
+
+static void prvInitialiseNewTask( TaskFunction_t pxTaskCode,
+                                  const char * const pcName, /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+                                  const uint32_t ulStackDepth,
+                                  void * const pvParameters,
+                                  UBaseType_t uxPriority,
+                                  TaskHandle_t * const pxCreatedTask,
+                                  TCB_t * pxNewTCB,
+                                  const MemoryRegion_t * const xRegions )
+{
+    StackType_t * pxTopOfStack;
+    UBaseType_t x;
+
+    #if ( portUSING_MPU_WRAPPERS == 1 )
+        /* Should the task be created in privileged mode? */
+        BaseType_t xRunPrivileged;
+
+        if( ( uxPriority & portPRIVILEGE_BIT ) != 0U )
+        {
+            xRunPrivileged = pdTRUE;
+        }
+        else
         {
             xRunPrivileged = pdFALSE;
         }
@@ -1133,6 +1832,118 @@ static void prvInitialiseNewTask( TaskFunction_t pxTaskCode,
         }
     #endif
 
+    /* E.C. : not periodic until created with xTaskPeriodicCreate(). */
+    #if ( configUSE_EDF_SCHEDULER == 1 )
+        {
+            pxNewTCB->xTaskPeriod = ( TickType_t ) 0U;
+            pxNewTCB->xTaskRelativeDeadline = ( TickType_t ) 0U;
+            pxNewTCB->xTaskDeadline = ( TickType_t ) 0U;
+            pxNewTCB->xTaskBudget = ( TickType_t ) 0U;
+            pxNewTCB->ulDeadlineMisses = 0UL;
+        }
+    #endif
+
+    /* E.C. : no job until the task is made periodic or leaves vTaskDelayUntil(). */
+    #if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_JOB_STATS == 1 ) )
+        {
+            pxNewTCB->ucJobState = taskEDF_JOB_COMPLETED;
+            pxNewTCB->ulJobReleaseTime = 0UL;
+            pxNewTCB->ulJobStartTime = 0UL;
+            pxNewTCB->ullResponseSum = 0ULL;
+            pxNewTCB->ullStartLatencySum = 0ULL;
+            memset( ( void * ) &( pxNewTCB->xJobStats ), 0x00, sizeof( pxNewTCB->xJobStats ) );
+        }
+    #endif
+
+    #if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_UTILIZATION == 1 ) )
+        {
+            pxNewTCB->ullRunTime = 0ULL;
+            pxNewTCB->ullWindowStartRunTime = 0ULL;
+            pxNewTCB->ulLastWindowRunTime = 0UL;
+            pxNewTCB->ulWindowNumber = ulEDFWindowNumber;
+        }
+    #endif
+
+    #if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_OVERLOAD == 1 ) )
+        {
+            pxNewTCB->xJobExecuted = ( TickType_t ) 0U;
+            pxNewTCB->uxTaskValue = ( UBaseType_t ) 0U;
+            pxNewTCB->pxTaskWakeTime = NULL;
+            pxNewTCB->ulJobsShed = 0UL;
+        }
+    #endif
+
+    #if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_FIRM == 1 ) )
+        {
+            pxNewTCB->uxFirmMaxSkipped = ( UBaseType_t ) 0U;
+            pxNewTCB->uxFirmWindow = ( UBaseType_t ) 0U;
+            pxNewTCB->uxFirmSkipped = ( UBaseType_t ) 0U;
+            pxNewTCB->ulFirmHistory = 0UL;
+        }
+    #endif
+
+    #if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_MIXED_CRITICALITY == 1 ) )
+        {
+            pxNewTCB->xTaskBudgetHigh = ( TickType_t ) 0U;
+            pxNewTCB->xTaskVirtualDeadline = ( TickType_t ) 0U;
+            pxNewTCB->ucVirtualDeadline = pdFALSE;
+        }
+    #endif
+
+    #if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_ELASTIC == 1 ) )
+        {
+            pxNewTCB->xTaskPeriodMin = ( TickType_t ) 0U;
+            pxNewTCB->xTaskPeriodMax = ( TickType_t ) 0U;
+            pxNewTCB->xTaskPeriodNext = ( TickType_t ) 0U;
+            pxNewTCB->uxElasticity = ( UBaseType_t ) 0U;
+            pxNewTCB->pxNextElastic = NULL;
+        }
+    #endif
+
+    #if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_MODES == 1 ) )
+        {
+            pxNewTCB->pxTaskLastWakeTime = NULL;
+        }
+    #endif
+
+    #if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_LIMITED_PREEMPTION == 1 ) )
+        {
+            pxNewTCB->xTaskNonPreemptive = ( TickType_t ) 0U;
+        }
+    #endif
+
+    #if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_PREEMPTION_THRESHOLD == 1 ) )
+        {
+            pxNewTCB->xTaskThreshold = ( TickType_t ) 0U;
+            pxNewTCB->xThresholdHeld = pdFALSE;
+        }
+    #endif
+
+    #if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( ( configUSE_EDF_SLACK_STEALING == 1 ) || ( configUSE_EDF_DVS == 1 ) ) )
+        {
+            pxNewTCB->pxNextPeriodic = NULL;
+        }
+    #endif
+
+    #if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_SLACK_STEALING == 1 ) )
+        {
+            pxNewTCB->ucSoft = pdFALSE;
+        }
+    #endif
+
+    #if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_DVS == 1 ) )
+        {
+            pxNewTCB->ulDVSShare = 0UL;
+            pxNewTCB->ullDVSWork = 0ULL;
+        }
+    #endif
+
+    #if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_TBS == 1 ) )
+        {
+            pxNewTCB->xServerSpan = ( TickType_t ) 0U;
+        }
+    #endif
+
     /* Initialize the TCB stack to look as if the task was already running,
      * but had been interrupted by the scheduler.  The return address is set
      * to the start of the task function. Once the stack has been initialised
@@ -1314,6 +2125,38 @@ static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB )
                 mtCOVERAGE_TEST_MARKER();
             }
 
+            /* E.C. : the task no longer takes part in the elastic compression. */
+            #if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_ELASTIC == 1 ) )
+                {
+                    TCB_t ** ppxElastic;
+
+                    for( ppxElastic = &pxEDFElasticTasks; *ppxElastic != NULL; ppxElastic = &( ( *ppxElastic )->pxNextElastic ) )
+                    {
+                        if( *ppxElastic == pxTCB )
+                        {
+                            *ppxElastic = pxTCB->pxNextElastic;
+                            break;
+                        }
+                    }
+                }
+            #endif
+
+            /* E.C. : nor in the slack of the hard tasks, nor in the speed. */
+            #if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( ( configUSE_EDF_SLACK_STEALING == 1 ) || ( configUSE_EDF_DVS == 1 ) ) )
+                {
+                    TCB_t ** ppxPeriodic;
+
+                    for( ppxPeriodic = &pxEDFPeriodicTasks; *ppxPeriodic != NULL; ppxPeriodic = &( ( *ppxPeriodic )->pxNextPeriodic ) )
+                    {
+                        if( *ppxPeriodic == pxTCB )
+                        {
+                            *ppxPeriodic = pxTCB->pxNextPeriodic;
+                            break;
+                        }
+                    }
+                }
+            #endif
+
             /* Increment the uxTaskNumber also so kernel aware debuggers can
              * detect that the task lists need re-generating.  This is done before
              * portPRE_TASK_DELETE_HOOK() as in the Windows port that macro will
@@ -1402,8 +2245,24 @@ static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB )
              * block. */
             const TickType_t xConstTickCount = xTickCount;
 
-            /* Generate the tick time at which the task wants to wake. */
-            xTimeToWake = *pxPreviousWakeTime + xTimeIncrement;
+            /* E.C. : a mode change that starts the task again moves the wake
+             * time on to the time it is released. */
+            #if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_MODES == 1 ) )
+                {
+                    pxCurrentTCB->pxTaskLastWakeTime = pxPreviousWakeTime;
+                }
+            #endif
+
+            /* Generate the tick time at which the task wants to wake.  E.C. :
+             * an elastic task waits out the period the job that has just
+             * completed was released with instead of xTimeIncrement.  A new
+             * period from xTaskEDFElasticAdapt() only starts with the next
+             * job, see below. */
+            #if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_ELASTIC == 1 ) )
+                xTimeToWake = *pxPreviousWakeTime + ( ( pxCurrentTCB->xTaskPeriodMax != ( TickType_t ) 0U ) ? pxCurrentTCB->xTaskPeriod : xTimeIncrement );
+            #else
+                xTimeToWake = *pxPreviousWakeTime + xTimeIncrement;
+            #endif
 
             if( xConstTickCount < *pxPreviousWakeTime )
             {
@@ -1439,16 +2298,106 @@ static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB )
             /* Update the wake time ready for the next call. */
             *pxPreviousWakeTime = xTimeToWake;
 
+            /* E.C. : calling vTaskDelayUntil() ends the current job.  A task
+             * without a period has no jobs, and so no deadline to miss. */
+            #if ( configUSE_EDF_SCHEDULER == 1 )
+                {
+                    if( ( pxCurrentTCB->xTaskPeriod != ( TickType_t ) 0U ) &&
+                        ( ( BaseType_t ) ( xConstTickCount - taskEDF_REAL_DEADLINE( pxCurrentTCB ) ) > 0 ) )
+                    {
+                        pxCurrentTCB->ulDeadlineMisses++;
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+            #endif
+
+            #if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_JOB_STATS == 1 ) )
+                {
+                    prvEDFRecordJobCompletion( pxCurrentTCB );
+                }
+            #endif
+
+            #if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_DVS == 1 ) )
+                {
+                    prvEDFDVSComplete( pxCurrentTCB );
+                }
+            #endif
+
+            #if ( configUSE_EDF_SCHEDULER == 1 )
+                {
+                    taskEDF_SLACK_STALE();
+                }
+            #endif
+
+            /* E.C. : a late result of a firm task is as good as a skipped
+             * one. */
+            #if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_FIRM == 1 ) )
+                {
+                    prvEDFFirmRecord( pxCurrentTCB, ( ( BaseType_t ) ( xConstTickCount - taskEDF_REAL_DEADLINE( pxCurrentTCB ) ) > 0 ) ? pdTRUE : pdFALSE );
+                }
+            #endif
+
+            /* E.C. : the job that has just completed kept the period it was
+             * released with, the next one gets the new period.  An implicit
+             * deadline stretches with it. */
+            #if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_ELASTIC == 1 ) )
+                {
+                    if( pxCurrentTCB->xTaskPeriodMax != ( TickType_t ) 0U )
+                    {
+                        if( pxCurrentTCB->xTaskRelativeDeadline == pxCurrentTCB->xTaskPeriod )
+                        {
+                            pxCurrentTCB->xTaskRelativeDeadline = pxCurrentTCB->xTaskPeriodNext;
+                        }
+                        else
+                        {
+                            mtCOVERAGE_TEST_MARKER();
+                        }
+
+                        pxCurrentTCB->xTaskPeriod = pxCurrentTCB->xTaskPeriodNext;
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+            #endif
+
             if( xShouldDelay != pdFALSE )
             {
                 traceTASK_DELAY_UNTIL( xTimeToWake );
 
+                /* E.C. : until the next job is dispatched it can be shed,
+                 * which moves the wake time on by a period. */
+                #if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_OVERLOAD == 1 ) )
+                    {
+                        pxCurrentTCB->pxTaskWakeTime = pxPreviousWakeTime;
+                    }
+                #endif
+
                 /* prvAddCurrentTaskToDelayedList() needs the block time, not
                  * the time to wake, so subtract the current tick count. */
                 prvAddCurrentTaskToDelayedList( xTimeToWake - xConstTickCount, pdFALSE );
             }
             else
             {
+                /* E.C. : the next release is already due, the new job starts
+                 * straight away.  Its deadline counts from the release time it
+                 * should have had, and the task is moved to its new place in
+                 * the ready list.  The scheduler is suspended so interrupts
+                 * cannot touch the ready list. */
+                #if ( configUSE_EDF_SCHEDULER == 1 )
+                    {
+                        ( void ) uxListRemove( &( pxCurrentTCB->xStateListItem ) );
+                        taskEDF_SET_DEADLINE( pxCurrentTCB, xTimeToWake );
+                        prvAddTaskToReadyList( pxCurrentTCB );
+                        taskEDF_RECORD_JOB_RELEASE( pxCurrentTCB );
+                        taskEDF_RECORD_JOB_START();
+                        taskEDF_HOLD_THRESHOLD();
+                    }
+                #endif
                 mtCOVERAGE_TEST_MARKER();
             }
         }
@@ -1471,510 +2420,666 @@ static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB )
 #endif /* INCLUDE_xTaskDelayUntil */
 /*-----------------------------------------------------------*/
 
-#if ( INCLUDE_vTaskDelay == 1 )
+#if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_TASK_NOTIFICATIONS == 1 ) )
 
-    void vTaskDelay( const TickType_t xTicksToDelay )
+    uint32_t ulTaskSporadicWait( void )
     {
-        BaseType_t xAlreadyYielded = pdFALSE;
+        uint32_t ulReturn;
 
-        /* A delay time of zero just forces a reschedule. */
-        if( xTicksToDelay > ( TickType_t ) 0U )
+        /* E.C. : calling ulTaskSporadicWait() ends the current job.  A task
+         * without a minimum inter-arrival time has no jobs to count. */
+        vTaskSuspendAll();
         {
-            configASSERT( uxSchedulerSuspended == 0 );
-            vTaskSuspendAll();
+            if( ( pxCurrentTCB->xTaskPeriod != ( TickType_t ) 0U ) &&
+                ( ( BaseType_t ) ( xTickCount - taskEDF_REAL_DEADLINE( pxCurrentTCB ) ) > 0 ) )
             {
-                traceTASK_DELAY();
-
-                /* A task that is removed from the event list while the
-                 * scheduler is suspended will not get placed in the ready
-                 * list or removed from the blocked list until the scheduler
-                 * is resumed.
-                 *
-                 * This task cannot be in an event list as it is the currently
-                 * executing task. */
-                prvAddCurrentTaskToDelayedList( xTicksToDelay, pdFALSE );
+                pxCurrentTCB->ulDeadlineMisses++;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
             }
-            xAlreadyYielded = xTaskResumeAll();
-        }
-        else
-        {
-            mtCOVERAGE_TEST_MARKER();
-        }
-
-        /* Force a reschedule if xTaskResumeAll has not already done so, we may
-         * have put ourselves to sleep. */
-        if( xAlreadyYielded == pdFALSE )
-        {
-            portYIELD_WITHIN_API();
-        }
-        else
-        {
-            mtCOVERAGE_TEST_MARKER();
-        }
-    }
-
-#endif /* INCLUDE_vTaskDelay */
-/*-----------------------------------------------------------*/
-
-#if ( ( INCLUDE_eTaskGetState == 1 ) || ( configUSE_TRACE_FACILITY == 1 ) || ( INCLUDE_xTaskAbortDelay == 1 ) )
 
-    eTaskState eTaskGetState( TaskHandle_t xTask )
-    {
-        eTaskState eReturn;
-        List_t const * pxStateList, * pxDelayedList, * pxOverflowedDelayedList;
-        const TCB_t * const pxTCB = xTask;
+            #if ( configUSE_EDF_JOB_STATS == 1 )
+                {
+                    prvEDFRecordJobCompletion( pxCurrentTCB );
+                }
+            #endif
 
-        configASSERT( pxTCB );
+            #if ( configUSE_EDF_DVS == 1 )
+                {
+                    prvEDFDVSComplete( pxCurrentTCB );
+                }
+            #endif
 
-        if( pxTCB == pxCurrentTCB )
-        {
-            /* The task calling this function is querying its own state. */
-            eReturn = eRunning;
+            taskEDF_SLACK_STALE();
         }
-        else
+        ( void ) xTaskResumeAll();
+
+        do
         {
             taskENTER_CRITICAL();
             {
-                pxStateList = listLIST_ITEM_CONTAINER( &( pxTCB->xStateListItem ) );
-                pxDelayedList = pxDelayedTaskList;
-                pxOverflowedDelayedList = pxOverflowDelayedTaskList;
+                if( pxCurrentTCB->ulNotifiedValue[ 0 ] == 0UL )
+                {
+                    /* Wait for vTaskSporadicReleaseFromISR(), which gives the
+                     * new job its deadline before readying the task. */
+                    pxCurrentTCB->ucNotifyState[ 0 ] = taskWAITING_NOTIFICATION;
+                    prvAddCurrentTaskToDelayedList( portMAX_DELAY, pdTRUE );
+                    traceTASK_NOTIFY_TAKE_BLOCK( 0 );
+                    portYIELD_WITHIN_API();
+                }
+                else
+                {
+                    /* Released while the last job was still running, so the
+                     * new job starts now and the task moves to its place in
+                     * the ready list, as in vTaskDelayUntil(). */
+                    ( void ) uxListRemove( &( pxCurrentTCB->xStateListItem ) );
+                    taskEDF_SET_DEADLINE( pxCurrentTCB, xTickCount );
+                    prvAddTaskToReadyList( pxCurrentTCB );
+                    taskEDF_RECORD_JOB_RELEASE( pxCurrentTCB );
+                    taskEDF_RECORD_JOB_START();
+                    taskEDF_HOLD_THRESHOLD();
+                    portYIELD_WITHIN_API();
+                }
             }
             taskEXIT_CRITICAL();
 
-            if( ( pxStateList == pxDelayedList ) || ( pxStateList == pxOverflowedDelayedList ) )
+            taskENTER_CRITICAL();
             {
-                /* The task being queried is referenced from one of the Blocked
-                 * lists. */
-                eReturn = eBlocked;
+                traceTASK_NOTIFY_TAKE( 0 );
+                ulReturn = pxCurrentTCB->ulNotifiedValue[ 0 ];
+                pxCurrentTCB->ulNotifiedValue[ 0 ] = 0UL;
+                pxCurrentTCB->ucNotifyState[ 0 ] = taskNOT_WAITING_NOTIFICATION;
             }
+            taskEXIT_CRITICAL();
 
-            #if ( INCLUDE_vTaskSuspend == 1 )
-                else if( pxStateList == &xSuspendedTaskList )
-                {
-                    /* The task being queried is referenced from the suspended
-                     * list.  Is it genuinely suspended or is it blocked
-                     * indefinitely? */
-                    if( listLIST_ITEM_CONTAINER( &( pxTCB->xEventListItem ) ) == NULL )
-                    {
-                        #if ( configUSE_TASK_NOTIFICATIONS == 1 )
-                            {
-                                BaseType_t x;
+            /* Without INCLUDE_vTaskSuspend a portMAX_DELAY wait can time
+             * out, which is not a release. */
+        } while( ulReturn == 0UL );
 
-                                /* The task does not appear on the event list item of
-                                 * and of the RTOS objects, but could still be in the
-                                 * blocked state if it is waiting on its notification
-                                 * rather than waiting on an object.  If not, is
-                                 * suspended. */
-                                eReturn = eSuspended;
+        return ulReturn;
+    }
+/*-----------------------------------------------------------*/
 
-                                for( x = 0; x < configTASK_NOTIFICATION_ARRAY_ENTRIES; x++ )
-                                {
-                                    if( pxTCB->ucNotifyState[ x ] == taskWAITING_NOTIFICATION )
-                                    {
-                                        eReturn = eBlocked;
-                                        break;
-                                    }
-                                }
-                            }
-                        #else /* if ( configUSE_TASK_NOTIFICATIONS == 1 ) */
-                            {
-                                eReturn = eSuspended;
-                            }
-                        #endif /* if ( configUSE_TASK_NOTIFICATIONS == 1 ) */
-                    }
-                    else
+    void vTaskSporadicReleaseFromISR( TaskHandle_t xTask,
+                                      BaseType_t * pxHigherPriorityTaskWoken )
+    {
+        TCB_t * pxTCB;
+        uint8_t ucOriginalNotifyState;
+        UBaseType_t uxSavedInterruptStatus;
+
+        configASSERT( xTask );
+        portASSERT_IF_INTERRUPT_PRIORITY_INVALID();
+
+        pxTCB = xTask;
+
+        uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+        {
+            ucOriginalNotifyState = pxTCB->ucNotifyState[ 0 ];
+            pxTCB->ucNotifyState[ 0 ] = taskNOTIFICATION_RECEIVED;
+            ( pxTCB->ulNotifiedValue[ 0 ] )++;
+
+            traceTASK_NOTIFY_GIVE_FROM_ISR( 0 );
+
+            /* Only a task that is waiting has finished its last job.  A
+             * release that arrives earlier is picked up, and given its
+             * deadline, by ulTaskSporadicWait(). */
+            if( ucOriginalNotifyState == taskWAITING_NOTIFICATION )
+            {
+                configASSERT( listLIST_ITEM_CONTAINER( &( pxTCB->xEventListItem ) ) == NULL );
+
+                /* Only the TCB copy of the deadline is set here, the state
+                 * list item still holds the wake time of the delayed list.
+                 * prvAddTaskToReadyList() picks the deadline up. */
+                pxTCB->xTaskDeadline = taskEDF_RELEASE_DEADLINE( pxTCB, xTickCount );
+                taskEDF_VIRTUAL_DEADLINE( pxTCB );
+                taskEDF_SOFT_DEADLINE( pxTCB );
+                taskEDF_NEW_JOB( pxTCB );
+                taskEDF_DVS_RELEASE( pxTCB );
+                taskEDF_RELEASE_THRESHOLD( pxTCB );
+                taskEDF_SLACK_STALE();
+                taskEDF_RECORD_JOB_RELEASE( pxTCB );
+
+                /* E.C. : the new job may need a higher speed straight away. */
+                #if ( configUSE_EDF_DVS == 1 )
                     {
-                        eReturn = eBlocked;
+                        if( xEDFSpeedStale != pdFALSE )
+                        {
+                            prvEDFDVSUpdateSpeed();
+                        }
+                        else
+                        {
+                            mtCOVERAGE_TEST_MARKER();
+                        }
                     }
-                }
-            #endif /* if ( INCLUDE_vTaskSuspend == 1 ) */
+                #endif
 
-            #if ( INCLUDE_vTaskDelete == 1 )
-                else if( ( pxStateList == &xTasksWaitingTermination ) || ( pxStateList == NULL ) )
+                if( uxSchedulerSuspended == ( UBaseType_t ) pdFALSE )
                 {
-                    /* The task being queried is referenced from the deleted
-                     * tasks list, or it is not referenced from any lists at
-                     * all. */
-                    eReturn = eDeleted;
+                    listREMOVE_ITEM( &( pxTCB->xStateListItem ) );
+                    prvAddTaskToReadyList( pxTCB );
+                }
+                else
+                {
+                    /* The delayed and ready lists cannot be accessed, so hold
+                     * this task pending until the scheduler is resumed. */
+                    listINSERT_END( &( xPendingReadyList ), &( pxTCB->xEventListItem ) );
                 }
-            #endif
 
-            else /*lint !e525 Negative indentation is intended to make use of pre-processor clearer. */
+                /* Under EDF it is the earlier deadline, not the priority,
+                 * that preempts, unless the running job is inside a
+                 * non-preemptive region. */
+                if( taskEDF_PREEMPTS( pxTCB ) && taskEDF_ABOVE_THRESHOLD( pxTCB ) && ( taskEDF_DEFER_PREEMPTION() == pdFALSE ) )
+                {
+                    if( pxHigherPriorityTaskWoken != NULL )
+                    {
+                        *pxHigherPriorityTaskWoken = pdTRUE;
+                    }
+
+                    xYieldPending = pdTRUE;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            else
             {
-                /* If the task is not in any other state, it must be in the
-                 * Ready (including pending ready) state. */
-                eReturn = eReady;
+                mtCOVERAGE_TEST_MARKER();
             }
         }
+        portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+    }
 
-        return eReturn;
-    } /*lint !e818 xTask cannot be a pointer to const because it is a typedef. */
-
-#endif /* INCLUDE_eTaskGetState */
+#endif /* ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_TASK_NOTIFICATIONS == 1 ) */
 /*-----------------------------------------------------------*/
 
-#if ( INCLUDE_uxTaskPriorityGet == 1 )
+#if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_JOB_STATS == 1 ) )
 
-    UBaseType_t uxTaskPriorityGet( const TaskHandle_t xTask )
+    static void prvEDFRecordJobCompletion( TCB_t * const pxTCB )
     {
-        TCB_t const * pxTCB;
-        UBaseType_t uxReturn;
+        EDFJobStats_t * const pxStats = &( pxTCB->xJobStats );
+        uint32_t ulResponse, ulLatency, ulScaled;
+        UBaseType_t uxBucket = 0;
 
-        taskENTER_CRITICAL();
+        /* Only a job that has been dispatched can complete.  This also skips
+         * the first call of a task that was not created with
+         * xTaskPeriodicCreate(). */
+        if( pxTCB->ucJobState == taskEDF_JOB_STARTED )
         {
-            /* If null is passed in here then it is the priority of the task
-             * that called uxTaskPriorityGet() that is being queried. */
-            pxTCB = prvGetTCBFromHandle( xTask );
-            uxReturn = pxTCB->uxPriority;
-        }
-        taskEXIT_CRITICAL();
+            /* Unsigned arithmetic, so a wrap of the time stamp clock between
+             * release and completion is harmless. */
+            ulResponse = configEDF_TIMESTAMP() - pxTCB->ulJobReleaseTime;
+            ulLatency = pxTCB->ulJobStartTime - pxTCB->ulJobReleaseTime;
 
-        return uxReturn;
-    }
+            if( pxStats->ulJobCount == 0UL )
+            {
+                pxStats->ulResponseMin = ulResponse;
+                pxStats->ulResponseMax = ulResponse;
+                pxStats->ulStartLatencyMin = ulLatency;
+                pxStats->ulStartLatencyMax = ulLatency;
+            }
+            else
+            {
+                if( ulResponse < pxStats->ulResponseMin )
+                {
+                    pxStats->ulResponseMin = ulResponse;
+                }
 
-#endif /* INCLUDE_uxTaskPriorityGet */
-/*-----------------------------------------------------------*/
+                if( ulResponse > pxStats->ulResponseMax )
+                {
+                    pxStats->ulResponseMax = ulResponse;
+                }
 
-#if ( INCLUDE_uxTaskPriorityGet == 1 )
+                if( ulLatency < pxStats->ulStartLatencyMin )
+                {
+                    pxStats->ulStartLatencyMin = ulLatency;
+                }
 
-    UBaseType_t uxTaskPriorityGetFromISR( const TaskHandle_t xTask )
-    {
-        TCB_t const * pxTCB;
-        UBaseType_t uxReturn, uxSavedInterruptState;
+                if( ulLatency > pxStats->ulStartLatencyMax )
+                {
+                    pxStats->ulStartLatencyMax = ulLatency;
+                }
+            }
 
-        /* RTOS ports that support interrupt nesting have the concept of a
-         * maximum  system call (or maximum API call) interrupt priority.
-         * Interrupts that are  above the maximum system call priority are keep
-         * permanently enabled, even when the RTOS kernel is in a critical section,
-         * but cannot make any calls to FreeRTOS API functions.  If configASSERT()
-         * is defined in FreeRTOSConfig.h then
-         * portASSERT_IF_INTERRUPT_PRIORITY_INVALID() will result in an assertion
-         * failure if a FreeRTOS API function is called from an interrupt that has
-         * been assigned a priority above the configured maximum system call
-         * priority.  Only FreeRTOS functions that end in FromISR can be called
-         * from interrupts  that have been assigned a priority at or (logically)
-         * below the maximum system call interrupt priority.  FreeRTOS maintains a
-         * separate interrupt safe API to ensure interrupt entry is as fast and as
-         * simple as possible.  More information (albeit Cortex-M specific) is
-         * provided on the following link:
-         * https://www.FreeRTOS.org/RTOS-Cortex-M3-M4.html */
-        portASSERT_IF_INTERRUPT_PRIORITY_INVALID();
+            pxStats->ulJobCount++;
+            pxTCB->ullResponseSum += ulResponse;
+            pxTCB->ullStartLatencySum += ulLatency;
 
-        uxSavedInterruptState = portSET_INTERRUPT_MASK_FROM_ISR();
+            /* floor( log2() ) of the scaled response time, the loop is bounded
+             * by the number of buckets rather than by the value. */
+            ulScaled = ulResponse >> configEDF_JOB_STATS_BUCKET_SHIFT;
+
+            while( ( ulScaled > 1UL ) && ( uxBucket < ( UBaseType_t ) ( configEDF_JOB_STATS_BUCKETS - 1 ) ) )
+            {
+                ulScaled >>= 1;
+                uxBucket++;
+            }
+
+            pxStats->ulResponseHistogram[ uxBucket ]++;
+        }
+        else
         {
-            /* If null is passed in here then it is the priority of the calling
-             * task that is being queried. */
-            pxTCB = prvGetTCBFromHandle( xTask );
-            uxReturn = pxTCB->uxPriority;
+            mtCOVERAGE_TEST_MARKER();
         }
-        portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptState );
 
-        return uxReturn;
+        pxTCB->ucJobState = taskEDF_JOB_COMPLETED;
     }
-
-#endif /* INCLUDE_uxTaskPriorityGet */
 /*-----------------------------------------------------------*/
 
-#if ( INCLUDE_vTaskPrioritySet == 1 )
-
-    void vTaskPrioritySet( TaskHandle_t xTask,
-                           UBaseType_t uxNewPriority )
+    void vTaskGetJobStats( TaskHandle_t xTask,
+                           EDFJobStats_t * pxJobStats )
     {
         TCB_t * pxTCB;
-        UBaseType_t uxCurrentBasePriority, uxPriorityUsedOnEntry;
-        BaseType_t xYieldRequired = pdFALSE;
+        uint64_t ullResponseSum, ullStartLatencySum;
 
-        configASSERT( uxNewPriority < configMAX_PRIORITIES );
+        configASSERT( pxJobStats );
 
-        /* Ensure the new priority is valid. */
-        if( uxNewPriority >= ( UBaseType_t ) configMAX_PRIORITIES )
+        taskENTER_CRITICAL();
         {
-            uxNewPriority = ( UBaseType_t ) configMAX_PRIORITIES - ( UBaseType_t ) 1U;
+            pxTCB = prvGetTCBFromHandle( xTask );
+            *pxJobStats = pxTCB->xJobStats;
+            ullResponseSum = pxTCB->ullResponseSum;
+            ullStartLatencySum = pxTCB->ullStartLatencySum;
+        }
+        taskEXIT_CRITICAL();
+
+        /* The divisions are done outside of the critical section. */
+        if( pxJobStats->ulJobCount > 0UL )
+        {
+            pxJobStats->ulResponseMean = ( uint32_t ) ( ullResponseSum / pxJobStats->ulJobCount );
+            pxJobStats->ulStartLatencyMean = ( uint32_t ) ( ullStartLatencySum / pxJobStats->ulJobCount );
         }
         else
         {
-            mtCOVERAGE_TEST_MARKER();
+            pxJobStats->ulResponseMean = 0UL;
+            pxJobStats->ulStartLatencyMean = 0UL;
         }
+    }
+/*-----------------------------------------------------------*/
+
+    void vTaskResetJobStats( TaskHandle_t xTask )
+    {
+        TCB_t * pxTCB;
 
         taskENTER_CRITICAL();
         {
-            /* If null is passed in here then it is the priority of the calling
-             * task that is being changed. */
             pxTCB = prvGetTCBFromHandle( xTask );
+            pxTCB->ullResponseSum = 0ULL;
+            pxTCB->ullStartLatencySum = 0ULL;
+            ( void ) memset( ( void * ) &( pxTCB->xJobStats ), 0x00, sizeof( pxTCB->xJobStats ) );
+        }
+        taskEXIT_CRITICAL();
+    }
 
-            traceTASK_PRIORITY_SET( pxTCB, uxNewPriority );
+#endif /* ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_JOB_STATS == 1 ) */
+/*-----------------------------------------------------------*/
 
-            #if ( configUSE_MUTEXES == 1 )
+#if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_OVERLOAD == 1 ) )
+
+    static void prvEDFShedOverload( void )
+    {
+        const ListItem_t * pxItem;
+        const ListItem_t * const pxEnd = listGET_END_MARKER( &( xReadyTasksListEDF ) );
+        TCB_t * pxTCB;
+        TCB_t * pxVictim;
+        TickType_t xDemand;
+        BaseType_t xOverloaded;
+
+        do
+        {
+            xDemand = ( TickType_t ) 0U;
+            xOverloaded = pdFALSE;
+            pxVictim = NULL;
+
+            /* The ready list is in deadline order, so when the walk reaches a
+             * job the demand holds everything EDF runs before it completes. */
+            for( pxItem = listGET_HEAD_ENTRY( &( xReadyTasksListEDF ) ); pxItem != pxEnd; pxItem = listGET_NEXT( pxItem ) )
+            {
+                pxTCB = listGET_LIST_ITEM_OWNER( pxItem );
+
+                if( pxTCB->xJobExecuted < pxTCB->xTaskBudget )
                 {
-                    uxCurrentBasePriority = pxTCB->uxBasePriority;
+                    xDemand += pxTCB->xTaskBudget - pxTCB->xJobExecuted;
                 }
-            #else
+
+                /* Only a job that has not started can be shed, and only if
+                 * its next release is still ahead. */
+                if( ( pxTCB->uxTaskValue > ( UBaseType_t ) 0U ) && taskEDF_CAN_SHED( pxTCB ) && taskEDF_FIRM_CAN_SKIP( pxTCB ) )
                 {
-                    uxCurrentBasePriority = pxTCB->uxPriority;
+                    if( ( pxVictim == NULL ) || ( pxTCB->uxTaskValue < pxVictim->uxTaskValue ) )
+                    {
+                        pxVictim = pxTCB;
+                    }
                 }
-            #endif
 
-            if( uxCurrentBasePriority != uxNewPriority )
-            {
-                /* The priority change may have readied a task of higher
-                 * priority than the calling task. */
-                if( uxNewPriority > uxCurrentBasePriority )
+                /* The list is keyed on the virtual deadlines of HI jobs in LO
+                 * mode, but a job is only late if it misses its real one. */
+                if( ( BaseType_t ) ( ( xTickCount + xDemand ) - taskEDF_REAL_DEADLINE( pxTCB ) ) > 0 )
                 {
-                    if( pxTCB != pxCurrentTCB )
+                    /* A firm job that would complete late is of no use, so it
+                     * is skipped itself if its task can afford it. */
+                    if( taskEDF_IS_FIRM( pxTCB ) && taskEDF_CAN_SHED( pxTCB ) && taskEDF_FIRM_CAN_SKIP( pxTCB ) )
                     {
-                        /* The priority of a task other than the currently
-                         * running task is being raised.  Is the priority being
-                         * raised above that of the running task? */
-                        if( uxNewPriority >= pxCurrentTCB->uxPriority )
-                        {
-                            xYieldRequired = pdTRUE;
-                        }
-                        else
-                        {
-                            mtCOVERAGE_TEST_MARKER();
-                        }
+                        pxVictim = pxTCB;
                     }
                     else
                     {
-                        /* The priority of the running task is being raised,
-                         * but the running task must already be the highest
-                         * priority task able to run so no yield is required. */
+                        mtCOVERAGE_TEST_MARKER();
                     }
+
+                    xOverloaded = pdTRUE;
+                    break;
                 }
-                else if( pxTCB == pxCurrentTCB )
-                {
-                    /* Setting the priority of the running task down means
-                     * there may now be another task of higher priority that
-                     * is ready to execute. */
-                    xYieldRequired = pdTRUE;
-                }
-                else
-                {
-                    /* Setting the priority of any other task down does not
-                     * require a yield as the running task must be above the
-                     * new priority of the task being modified. */
-                }
+            }
 
-                /* Remember the ready list the task might be referenced from
-                 * before its uxPriority member is changed so the
-                 * taskRESET_READY_PRIORITY() macro can function correctly. */
-                uxPriorityUsedOnEntry = pxTCB->uxPriority;
+            /* Shedding a job that comes after the one that misses would not
+             * help it, so the victim is taken from the jobs walked so far. */
+            if( ( xOverloaded != pdFALSE ) && ( pxVictim != NULL ) )
+            {
+                prvEDFShedJob( pxVictim );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        } while( ( xOverloaded != pdFALSE ) && ( pxVictim != NULL ) );
+    }
+/*-----------------------------------------------------------*/
 
-                #if ( configUSE_MUTEXES == 1 )
-                    {
-                        /* Only change the priority being used if the task is not
-                         * currently using an inherited priority. */
-                        if( pxTCB->uxBasePriority == pxTCB->uxPriority )
-                        {
-                            pxTCB->uxPriority = uxNewPriority;
-                        }
-                        else
-                        {
-                            mtCOVERAGE_TEST_MARKER();
-                        }
+    static void prvEDFShedJob( TCB_t * const pxTCB )
+    {
+        const TickType_t xNextRelease = *( pxTCB->pxTaskWakeTime ) + pxTCB->xTaskPeriod;
 
-                        /* The base priority gets set whatever. */
-                        pxTCB->uxBasePriority = uxNewPriority;
-                    }
-                #else /* if ( configUSE_MUTEXES == 1 ) */
-                    {
-                        pxTCB->uxPriority = uxNewPriority;
-                    }
-                #endif /* if ( configUSE_MUTEXES == 1 ) */
+        if( uxListRemove( &( pxTCB->xStateListItem ) ) == ( UBaseType_t ) 0 )
+        {
+            taskRESET_READY_PRIORITY( pxTCB->uxPriority );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
 
-                /* Only reset the event list item value if the value is not
-                 * being used for anything else. */
-                if( ( listGET_LIST_ITEM_VALUE( &( pxTCB->xEventListItem ) ) & taskEVENT_LIST_ITEM_VALUE_IN_USE ) == 0UL )
-                {
-                    listSET_LIST_ITEM_VALUE( &( pxTCB->xEventListItem ), ( ( TickType_t ) configMAX_PRIORITIES - ( TickType_t ) uxNewPriority ) ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
-                }
-                else
-                {
-                    mtCOVERAGE_TEST_MARKER();
-                }
+        /* vTaskDelayUntil() returns one period later than it would have, as
+         * if the task had been late for this release. */
+        *( pxTCB->pxTaskWakeTime ) = xNextRelease;
+        pxTCB->ulJobsShed++;
+        traceEDF_JOB_SHED( pxTCB );
 
-                /* If the task is in the blocked or suspended list we need do
-                 * nothing more than change its priority variable. However, if
-                 * the task is in a ready list it needs to be removed and placed
-                 * in the list appropriate to its new priority. */
-                if( listIS_CONTAINED_WITHIN( &( pxReadyTasksLists[ uxPriorityUsedOnEntry ] ), &( pxTCB->xStateListItem ) ) != pdFALSE )
-                {
-                    /* The task is currently in its ready list - remove before
-                     * adding it to its new ready list.  As we are in a critical
-                     * section we can do this even if the scheduler is suspended. */
-                    if( uxListRemove( &( pxTCB->xStateListItem ) ) == ( UBaseType_t ) 0 )
-                    {
-                        /* It is known that the task is in its ready list so
-                         * there is no need to check again and the port level
-                         * reset macro can be called directly. */
-                        portRESET_READY_PRIORITY( uxPriorityUsedOnEntry, uxTopReadyPriority );
-                    }
-                    else
-                    {
-                        mtCOVERAGE_TEST_MARKER();
-                    }
+        #if ( configUSE_EDF_FIRM == 1 )
+            {
+                prvEDFFirmRecord( pxTCB, pdTRUE );
+            }
+        #endif
 
-                    prvAddTaskToReadyList( pxTCB );
-                }
-                else
-                {
-                    mtCOVERAGE_TEST_MARKER();
-                }
+        taskEDF_SLACK_STALE();
 
-                if( xYieldRequired != pdFALSE )
-                {
-                    taskYIELD_IF_USING_PREEMPTION();
-                }
-                else
-                {
-                    mtCOVERAGE_TEST_MARKER();
-                }
+        /* The shed job never completes, so it is not recorded either. */
+        #if ( configUSE_EDF_JOB_STATS == 1 )
+            {
+                pxTCB->ucJobState = taskEDF_JOB_COMPLETED;
+            }
+        #endif
 
-                /* Remove compiler warning about unused variables when the port
-                 * optimised task selection is not being used. */
-                ( void ) uxPriorityUsedOnEntry;
+        listSET_LIST_ITEM_VALUE( &( pxTCB->xStateListItem ), xNextRelease );
+
+        if( xNextRelease < xTickCount )
+        {
+            /* Wake time has overflowed. */
+            vListInsert( pxOverflowDelayedTaskList, &( pxTCB->xStateListItem ) );
+        }
+        else
+        {
+            vListInsert( pxDelayedTaskList, &( pxTCB->xStateListItem ) );
+
+            if( xNextRelease < xNextTaskUnblockTime )
+            {
+                xNextTaskUnblockTime = xNextRelease;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
             }
         }
-        taskEXIT_CRITICAL();
     }
 
-#endif /* INCLUDE_vTaskPrioritySet */
+#endif /* ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_OVERLOAD == 1 ) */
 /*-----------------------------------------------------------*/
 
-#if ( INCLUDE_vTaskSuspend == 1 )
+#if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_FIRM == 1 ) )
 
-    void vTaskSuspend( TaskHandle_t xTaskToSuspend )
+    static void prvEDFFirmRecord( TCB_t * const pxTCB,
+                                  BaseType_t xMissed )
     {
-        TCB_t * pxTCB;
+        UBaseType_t uxBits;
 
-        taskENTER_CRITICAL();
+        /* Only the last k - 1 outcomes decide whether the next job can be
+         * skipped, with k = 1 no job can be. */
+        if( pxTCB->uxFirmWindow > ( UBaseType_t ) 1U )
         {
-            /* If null is passed in here then it is the running task that is
-             * being suspended. */
-            pxTCB = prvGetTCBFromHandle( xTaskToSuspend );
-
-            traceTASK_SUSPEND( pxTCB );
+            uxBits = pxTCB->uxFirmWindow - ( UBaseType_t ) 1U;
 
-            /* Remove task from the ready/delayed list and place in the
-             * suspended list. */
-            if( uxListRemove( &( pxTCB->xStateListItem ) ) == ( UBaseType_t ) 0 )
+            /* The oldest outcome drops out of the window. */
+            if( ( ( pxTCB->ulFirmHistory >> ( uxBits - ( UBaseType_t ) 1U ) ) & 1UL ) != 0UL )
             {
-                taskRESET_READY_PRIORITY( pxTCB->uxPriority );
+                pxTCB->uxFirmSkipped--;
             }
             else
             {
                 mtCOVERAGE_TEST_MARKER();
             }
 
-            /* Is the task waiting on an event also? */
-            if( listLIST_ITEM_CONTAINER( &( pxTCB->xEventListItem ) ) != NULL )
+            pxTCB->ulFirmHistory = ( ( pxTCB->ulFirmHistory << 1 ) | ( ( xMissed != pdFALSE ) ? 1UL : 0UL ) ) & ( ( 1UL << uxBits ) - 1UL );
+
+            if( xMissed != pdFALSE )
             {
-                ( void ) uxListRemove( &( pxTCB->xEventListItem ) );
+                pxTCB->uxFirmSkipped++;
             }
             else
             {
                 mtCOVERAGE_TEST_MARKER();
             }
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
 
-            vListInsertEnd( &xSuspendedTaskList, &( pxTCB->xStateListItem ) );
+#endif /* ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_FIRM == 1 ) */
+/*-----------------------------------------------------------*/
 
-            #if ( configUSE_TASK_NOTIFICATIONS == 1 )
-                {
-                    BaseType_t x;
+#if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_MIXED_CRITICALITY == 1 ) )
 
-                    for( x = 0; x < configTASK_NOTIFICATION_ARRAY_ENTRIES; x++ )
-                    {
-                        if( pxTCB->ucNotifyState[ x ] == taskWAITING_NOTIFICATION )
-                        {
-                            /* The task was blocked to wait for a notification, but is
-                             * now suspended, so no notification was received. */
-                            pxTCB->ucNotifyState[ x ] = taskNOT_WAITING_NOTIFICATION;
-                        }
-                    }
-                }
-            #endif /* if ( configUSE_TASK_NOTIFICATIONS == 1 ) */
+    static void prvEDFSwitchToHighCriticality( void )
+    {
+        ListItem_t * pxItem;
+        ListItem_t * pxNext;
+        const ListItem_t * const pxEnd = listGET_END_MARKER( &( xReadyTasksListEDF ) );
+        TCB_t * pxTCB;
+
+        xEDFCriticalityMode = edfCRITICALITY_HI;
+        traceEDF_CRITICALITY_MODE( xEDFCriticalityMode );
+
+        /* A HI job given its real deadline back moves further down the list,
+         * where it is passed over as its deadline is no longer virtual. */
+        for( pxItem = listGET_HEAD_ENTRY( &( xReadyTasksListEDF ) ); pxItem != pxEnd; pxItem = pxNext )
+        {
+            pxNext = listGET_NEXT( pxItem );
+            pxTCB = listGET_LIST_ITEM_OWNER( pxItem );
+
+            if( pxTCB->ucVirtualDeadline != pdFALSE )
+            {
+                ( void ) uxListRemove( &( pxTCB->xStateListItem ) );
+                pxTCB->xTaskDeadline = taskEDF_REAL_DEADLINE( pxTCB );
+                pxTCB->ucVirtualDeadline = pdFALSE;
+                prvAddTaskToReadyList( pxTCB );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
         }
-        taskEXIT_CRITICAL();
 
-        if( xSchedulerRunning != pdFALSE )
+        prvEDFShedLowCriticality();
+    }
+/*-----------------------------------------------------------*/
+
+    static void prvEDFShedLowCriticality( void )
+    {
+        ListItem_t * pxItem;
+        ListItem_t * pxNext;
+        const ListItem_t * const pxEnd = listGET_END_MARKER( &( xReadyTasksListEDF ) );
+        TCB_t * pxTCB;
+
+        /* A LO job that has already started runs to completion. */
+        for( pxItem = listGET_HEAD_ENTRY( &( xReadyTasksListEDF ) ); pxItem != pxEnd; pxItem = pxNext )
         {
-            /* Reset the next expected unblock time in case it referred to the
-             * task that is now in the Suspended state. */
-            taskENTER_CRITICAL();
+            pxNext = listGET_NEXT( pxItem );
+            pxTCB = listGET_LIST_ITEM_OWNER( pxItem );
+
+            if( ( pxTCB->xTaskBudgetHigh == ( TickType_t ) 0U ) && taskEDF_CAN_SHED( pxTCB ) )
             {
-                prvResetNextTaskUnblockTime();
+                prvEDFShedJob( pxTCB );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
             }
-            taskEXIT_CRITICAL();
         }
-        else
+    }
+
+#endif /* ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_MIXED_CRITICALITY == 1 ) */
+/*-----------------------------------------------------------*/
+
+#if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_SLACK_STEALING == 1 ) )
+
+    static BaseType_t prvEDFStealSlack( void )
+    {
+        TCB_t * pxTCB;
+        TickType_t xSlack, xKey;
+        const TickType_t xElapsed = xTickCount - xEDFSlackTick;
+        BaseType_t xSwitchRequired = pdFALSE;
+
+        /* Nothing to work out unless a soft job is ready. */
+        for( pxTCB = pxEDFPeriodicTasks; pxTCB != NULL; pxTCB = pxTCB->pxNextPeriodic )
         {
-            mtCOVERAGE_TEST_MARKER();
+            if( ( pxTCB->ucSoft != pdFALSE ) && taskEDF_IS_READY( pxTCB ) )
+            {
+                break;
+            }
         }
 
-        if( pxTCB == pxCurrentTCB )
+        if( pxTCB != NULL )
         {
-            if( xSchedulerRunning != pdFALSE )
+            /* Working the slack out takes far longer than a tick should, so
+             * it is only done when a job completes or is released
+             * sporadically, which can give slack back, or once the deadline
+             * it was found at has passed.  In between the slack is used up a
+             * tick per tick, which can only underestimate it. */
+            if( ( xEDFSlackStale != pdFALSE ) || ( ( BaseType_t ) ( xTickCount - xEDFSlackCheckpoint ) >= 0 ) )
             {
-                /* The current task has just been suspended. */
-                configASSERT( uxSchedulerSuspended == 0 );
-                portYIELD_WITHIN_API();
+                xEDFSlackStale = pdFALSE;
+                xEDFSlackTick = xTickCount;
+                xEDFSlack = prvEDFSlack( &xEDFSlackCheckpoint );
+                xSlack = xEDFSlack;
+            }
+            else if( xEDFSlack > xElapsed )
+            {
+                xSlack = xEDFSlack - xElapsed;
             }
             else
             {
-                /* The scheduler is not running, but the task that was pointed
-                 * to by pxCurrentTCB has just been suspended and pxCurrentTCB
-                 * must be adjusted to point to a different task. */
-                if( listCURRENT_LIST_LENGTH( &xSuspendedTaskList ) == uxCurrentNumberOfTasks ) /*lint !e931 Right has no side effect, just volatile. */
+                xSlack = ( TickType_t ) 0U;
+            }
+
+            for( ; pxTCB != NULL; pxTCB = pxTCB->pxNextPeriodic )
+            {
+                if( ( pxTCB->ucSoft != pdFALSE ) && taskEDF_IS_READY( pxTCB ) )
                 {
-                    /* No other tasks are ready, so set pxCurrentTCB back to
-                     * NULL so when the next task is created pxCurrentTCB will
-                     * be set to point to it no matter what its relative priority
-                     * is. */
-                    pxCurrentTCB = NULL;
+                    /* With slack the soft job is keyed on the current tick,
+                     * ahead of every hard job that is not already late, and
+                     * stays there for as long as the slack lasts.  Without it
+                     * the soft job goes behind the hard jobs due by the
+                     * deadline that has no slack left. */
+                    if( xSlack > ( TickType_t ) 0U )
+                    {
+                        xKey = ( ( BaseType_t ) ( pxTCB->xTaskDeadline - xTickCount ) > 0 ) ? xTickCount : pxTCB->xTaskDeadline;
+                    }
+                    else
+                    {
+                        xKey = xEDFSlackCheckpoint;
+                    }
+
+                    if( xKey != pxTCB->xTaskDeadline )
+                    {
+                        ( void ) uxListRemove( &( pxTCB->xStateListItem ) );
+                        pxTCB->xTaskDeadline = xKey;
+                        prvAddTaskToReadyList( pxTCB );
+                        xSwitchRequired = pdTRUE;
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
                 }
                 else
                 {
-                    vTaskSwitchContext();
+                    mtCOVERAGE_TEST_MARKER();
                 }
             }
         }
         else
         {
-            mtCOVERAGE_TEST_MARKER();
+            /* Start afresh once a soft job is ready again. */
+            xEDFSlackStale = pdTRUE;
         }
-    }
 
-#endif /* INCLUDE_vTaskSuspend */
+        return xSwitchRequired;
+    }
 /*-----------------------------------------------------------*/
 
-#if ( INCLUDE_vTaskSuspend == 1 )
-
-    static BaseType_t prvTaskIsTaskSuspended( const TaskHandle_t xTask )
+    static TickType_t prvEDFSlack( TickType_t * const pxCheckpoint )
     {
-        BaseType_t xReturn = pdFALSE;
-        const TCB_t * const pxTCB = xTask;
-
-        /* Accesses xPendingReadyList so must be called from a critical
-         * section. */
+        const TickType_t xConstTickCount = xTickCount;
+        const TCB_t * pxTCB;
+        TickType_t xDeadline, xDemand, xSlack = configEDF_SLACK_HORIZON;
+        BaseType_t xWindow;
 
-        /* It does not make sense to check if the calling task is suspended. */
-        configASSERT( xTask );
+        *pxCheckpoint = xConstTickCount + configEDF_SLACK_HORIZON;
 
-        /* Is the task being resumed actually in the suspended list? */
-        if( listIS_CONTAINED_WITHIN( &xSuspendedTaskList, &( pxTCB->xStateListItem ) ) != pdFALSE )
+        /* The demand of the hard jobs only grows at their deadlines, so the
+         * least slack is found at one of them. */
+        for( pxTCB = pxEDFPeriodicTasks; ( pxTCB != NULL ) && ( xSlack > ( TickType_t ) 0U ); pxTCB = pxTCB->pxNextPeriodic )
         {
-            /* Has the task already been resumed from within an ISR? */
-            if( listIS_CONTAINED_WITHIN( &xPendingReadyList, &( pxTCB->xEventListItem ) ) == pdFALSE )
+            if( taskEDF_IS_HARD( pxTCB ) )
             {
-                /* Is it in the suspended list because it is in the Suspended
-                 * state, or because is is blocked with no timeout? */
-                if( listIS_CONTAINED_WITHIN( NULL, &( pxTCB->xEventListItem ) ) != pdFALSE ) /*lint !e961.  The cast is only redundant when NULL is used. */
+                if( taskEDF_IS_READY( pxTCB ) )
                 {
-                    xReturn = pdTRUE;
+                    xDeadline = taskEDF_REAL_DEADLINE( pxTCB );
                 }
                 else
                 {
-                    mtCOVERAGE_TEST_MARKER();
+                    xDeadline = prvEDFNextRelease( pxTCB ) + pxTCB->xTaskRelativeDeadline;
+                }
+
+                for( xWindow = ( BaseType_t ) ( xDeadline - xConstTickCount );
+                     ( xWindow <= ( BaseType_t ) configEDF_SLACK_HORIZON ) && ( xSlack > ( TickType_t ) 0U );
+                     xWindow += ( BaseType_t ) pxTCB->xTaskPeriod )
+                {
+                    xDeadline = xConstTickCount + ( TickType_t ) xWindow;
+                    xDemand = prvEDFHardDemand( xDeadline );
+
+                    if( xWindow - ( BaseType_t ) xDemand < ( BaseType_t ) xSlack )
+                    {
+                        xSlack = ( xWindow > ( BaseType_t ) xDemand ) ? ( TickType_t ) xWindow - xDemand : ( TickType_t ) 0U;
+                        *pxCheckpoint = xDeadline;
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
                 }
             }
             else
@@ -1982,772 +3087,2281 @@ static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB )
                 mtCOVERAGE_TEST_MARKER();
             }
         }
-        else
-        {
-            mtCOVERAGE_TEST_MARKER();
-        }
-
-        return xReturn;
-    } /*lint !e818 xTask cannot be a pointer to const because it is a typedef. */
 
-#endif /* INCLUDE_vTaskSuspend */
+        return xSlack;
+    }
 /*-----------------------------------------------------------*/
 
-#if ( INCLUDE_vTaskSuspend == 1 )
-
-    void vTaskResume( TaskHandle_t xTaskToResume )
+    static TickType_t prvEDFHardDemand( TickType_t xDeadline )
     {
-        TCB_t * const pxTCB = xTaskToResume;
+        const TCB_t * pxTCB;
+        TickType_t xDemand = ( TickType_t ) 0U;
+        BaseType_t xSpan;
 
-        /* It does not make sense to resume the calling task. */
-        configASSERT( xTaskToResume );
-
-        /* The parameter cannot be NULL as it is impossible to resume the
-         * currently executing task. */
-        if( ( pxTCB != pxCurrentTCB ) && ( pxTCB != NULL ) )
+        for( pxTCB = pxEDFPeriodicTasks; pxTCB != NULL; pxTCB = pxTCB->pxNextPeriodic )
         {
-            taskENTER_CRITICAL();
+            if( taskEDF_IS_HARD( pxTCB ) )
             {
-                if( prvTaskIsTaskSuspended( pxTCB ) != pdFALSE )
+                /* What is left of the ready job, if it is due by xDeadline. */
+                if( taskEDF_IS_READY( pxTCB ) &&
+                    ( ( BaseType_t ) ( xDeadline - taskEDF_REAL_DEADLINE( pxTCB ) ) >= 0 ) &&
+                    ( pxTCB->xJobExecuted < pxTCB->xTaskBudget ) )
                 {
-                    traceTASK_RESUME( pxTCB );
+                    xDemand += pxTCB->xTaskBudget - pxTCB->xJobExecuted;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
 
-                    /* The ready list can be accessed even if the scheduler is
-                     * suspended because this is inside a critical section. */
-                    ( void ) uxListRemove( &( pxTCB->xStateListItem ) );
-                    prvAddTaskToReadyList( pxTCB );
+                /* Every job still to be released that is due by xDeadline. */
+                xSpan = ( BaseType_t ) ( xDeadline - prvEDFNextRelease( pxTCB ) - pxTCB->xTaskRelativeDeadline );
 
-                    /* A higher priority task may have just been resumed. */
-                    if( pxTCB->uxPriority >= pxCurrentTCB->uxPriority )
-                    {
-                        /* This yield may not cause the task just resumed to run,
-                         * but will leave the lists in the correct state for the
-                         * next yield. */
-                        taskYIELD_IF_USING_PREEMPTION();
-                    }
-                    else
-                    {
-                        mtCOVERAGE_TEST_MARKER();
-                    }
+                if( xSpan >= 0 )
+                {
+                    xDemand += ( ( ( TickType_t ) xSpan / pxTCB->xTaskPeriod ) + ( TickType_t ) 1U ) * pxTCB->xTaskBudget;
                 }
                 else
                 {
                     mtCOVERAGE_TEST_MARKER();
                 }
             }
-            taskEXIT_CRITICAL();
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+
+        return xDemand;
+    }
+/*-----------------------------------------------------------*/
+
+    static TickType_t prvEDFNextRelease( const TCB_t * const pxTCB )
+    {
+        /* One period after the release of the current or last job, or now if
+         * that has passed, as it may for a sporadic task. */
+        TickType_t xRelease = taskEDF_REAL_DEADLINE( pxTCB ) - pxTCB->xTaskRelativeDeadline + pxTCB->xTaskPeriod;
+
+        if( ( BaseType_t ) ( xRelease - xTickCount ) < 0 )
+        {
+            xRelease = xTickCount;
         }
         else
         {
             mtCOVERAGE_TEST_MARKER();
         }
-    }
 
-#endif /* INCLUDE_vTaskSuspend */
+        return xRelease;
+    }
 
+#endif /* ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_SLACK_STEALING == 1 ) */
 /*-----------------------------------------------------------*/
 
-#if ( ( INCLUDE_xTaskResumeFromISR == 1 ) && ( INCLUDE_vTaskSuspend == 1 ) )
+#if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_DVS == 1 ) )
 
-    BaseType_t xTaskResumeFromISR( TaskHandle_t xTaskToResume )
+    static void prvEDFDVSRelease( TCB_t * const pxTCB )
     {
-        BaseType_t xYieldRequired = pdFALSE;
-        TCB_t * const pxTCB = xTaskToResume;
-        UBaseType_t uxSavedInterruptStatus;
+        uint32_t ulShare = 0UL;
 
-        configASSERT( xTaskToResume );
+        if( pxTCB->xTaskBudget != ( TickType_t ) 0U )
+        {
+            ulShare = ( uint32_t ) ( ( ( uint64_t ) pxTCB->xTaskBudget * 1000000ULL + ( uint64_t ) pxTCB->xTaskPeriod - 1ULL ) / ( uint64_t ) pxTCB->xTaskPeriod );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
 
-        /* RTOS ports that support interrupt nesting have the concept of a
-         * maximum  system call (or maximum API call) interrupt priority.
-         * Interrupts that are  above the maximum system call priority are keep
-         * permanently enabled, even when the RTOS kernel is in a critical section,
-         * but cannot make any calls to FreeRTOS API functions.  If configASSERT()
-         * is defined in FreeRTOSConfig.h then
-         * portASSERT_IF_INTERRUPT_PRIORITY_INVALID() will result in an assertion
-         * failure if a FreeRTOS API function is called from an interrupt that has
-         * been assigned a priority above the configured maximum system call
-         * priority.  Only FreeRTOS functions that end in FromISR can be called
-         * from interrupts  that have been assigned a priority at or (logically)
-         * below the maximum system call interrupt priority.  FreeRTOS maintains a
-         * separate interrupt safe API to ensure interrupt entry is as fast and as
-         * simple as possible.  More information (albeit Cortex-M specific) is
-         * provided on the following link:
-         * https://www.FreeRTOS.org/RTOS-Cortex-M3-M4.html */
-        portASSERT_IF_INTERRUPT_PRIORITY_INVALID();
+        pxTCB->ullDVSWork = 0ULL;
 
-        uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+        /* The idle task is released every tick, only a change is worth
+         * working the speed out again for. */
+        if( ulShare != pxTCB->ulDVSShare )
         {
-            if( prvTaskIsTaskSuspended( pxTCB ) != pdFALSE )
-            {
-                traceTASK_RESUME_FROM_ISR( pxTCB );
+            pxTCB->ulDVSShare = ulShare;
+            xEDFSpeedStale = pdTRUE;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+/*-----------------------------------------------------------*/
 
-                /* Check the ready lists can be accessed. */
-                if( uxSchedulerSuspended == ( UBaseType_t ) pdFALSE )
-                {
-                    /* Ready lists can be accessed so move the task from the
-                     * suspended list to the ready list directly. */
-                    if( pxTCB->uxPriority >= pxCurrentTCB->uxPriority )
-                    {
-                        xYieldRequired = pdTRUE;
+    static void prvEDFDVSComplete( TCB_t * const pxTCB )
+    {
+        uint64_t ullWork;
 
-                        /* Mark that a yield is pending in case the user is not
-                         * using the return value to initiate a context switch
-                         * from the ISR using portYIELD_FROM_ISR. */
-                        xYieldPending = pdTRUE;
-                    }
-                    else
-                    {
-                        mtCOVERAGE_TEST_MARKER();
-                    }
+        if( pxTCB->xTaskBudget != ( TickType_t ) 0U )
+        {
+            /* The tick only samples the work, the part tick the job ran last
+             * is charged in full.  Never more than the budget.  The scheduler
+             * is suspended, so the tick does not add to the work while it is
+             * read. */
+            ullWork = pxTCB->ullDVSWork + ( uint64_t ) ulEDFSpeed;
 
-                    ( void ) uxListRemove( &( pxTCB->xStateListItem ) );
-                    prvAddTaskToReadyList( pxTCB );
-                }
-                else
-                {
-                    /* The delayed or ready lists cannot be accessed so the task
-                     * is held in the pending ready list until the scheduler is
-                     * unsuspended. */
-                    vListInsertEnd( &( xPendingReadyList ), &( pxTCB->xEventListItem ) );
-                }
+            if( ullWork > ( ( uint64_t ) pxTCB->xTaskBudget * 1000000ULL ) )
+            {
+                ullWork = ( uint64_t ) pxTCB->xTaskBudget * 1000000ULL;
             }
             else
             {
                 mtCOVERAGE_TEST_MARKER();
             }
-        }
-        portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
 
-        return xYieldRequired;
+            /* The lower speed is taken up at the next tick, which can only
+             * be late on the safe side. */
+            pxTCB->ulDVSShare = ( uint32_t ) ( ( ullWork + ( uint64_t ) pxTCB->xTaskPeriod - 1ULL ) / ( uint64_t ) pxTCB->xTaskPeriod );
+            xEDFSpeedStale = pdTRUE;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
     }
-
-#endif /* ( ( INCLUDE_xTaskResumeFromISR == 1 ) && ( INCLUDE_vTaskSuspend == 1 ) ) */
 /*-----------------------------------------------------------*/
 
-void vTaskStartScheduler( void )
-{
-    BaseType_t xReturn;
+    static void prvEDFDVSUpdateSpeed( void )
+    {
+        const TCB_t * pxTCB;
+        uint32_t ulSpeed = 0UL;
 
-    /* Add the idle task at the lowest priority. */
-    #if ( configSUPPORT_STATIC_ALLOCATION == 1 )
-        {
-            StaticTask_t * pxIdleTaskTCBBuffer = NULL;
-            StackType_t * pxIdleTaskStackBuffer = NULL;
-            uint32_t ulIdleTaskStackSize;
+        xEDFSpeedStale = pdFALSE;
 
-            /* The Idle task is created using user provided RAM - obtain the
-             * address of the RAM then create the idle task. */
-            vApplicationGetIdleTaskMemory( &pxIdleTaskTCBBuffer, &pxIdleTaskStackBuffer, &ulIdleTaskStackSize );
-            xIdleTaskHandle = xTaskCreateStatic( prvIdleTask,
-                                                 configIDLE_TASK_NAME,
-                                                 ulIdleTaskStackSize,
-                                                 ( void * ) NULL,       /*lint !e961.  The cast is not redundant for all compilers. */
-                                                 portPRIVILEGE_BIT,     /* In effect ( tskIDLE_PRIORITY | portPRIVILEGE_BIT ), but tskIDLE_PRIORITY is zero. */
-                                                 pxIdleTaskStackBuffer,
-                                                 pxIdleTaskTCBBuffer ); /*lint !e961 MISRA exception, justified as it is not a redundant explicit cast to all supported compilers. */
+        for( pxTCB = pxEDFPeriodicTasks; pxTCB != NULL; pxTCB = pxTCB->pxNextPeriodic )
+        {
+            ulSpeed += pxTCB->ulDVSShare;
+        }
 
-            if( xIdleTaskHandle != NULL )
-            {
-                xReturn = pdPASS;
-            }
-            else
-            {
-                xReturn = pdFAIL;
-            }
+        if( ulSpeed > 1000000UL )
+        {
+            ulSpeed = 1000000UL;
         }
-    #else /* if ( configSUPPORT_STATIC_ALLOCATION == 1 ) */
+        else
         {
-	//////////////////////////////*********************************/////////////////////////////				
-			/*E.C. : */
-			#if (configUSE_EDF_SCHEDULER == 1)
-			{
-				TickType_t initIDLEPeriod = 200;
-				xReturn = xTaskPeriodicCreate( 	prvIdleTask,
-												"IDLE",
-												configMINIMAL_STACK_SIZE, 
-												(void * ) NULL, 
-												0,
-												&xIdleTaskHandle,
-												initIDLEPeriod );
-			}
-			#else
-            {
-				/* The Idle task is being created using dynamically allocated RAM. */
-				xReturn = xTaskCreate( prvIdleTask,
-									   configIDLE_TASK_NAME,
-									   configMINIMAL_STACK_SIZE,
-									   ( void * ) NULL,
-									   (tskIDLE_PRIORITY|portPRIVILEGE_BIT),  /* In effect ( tskIDLE_PRIORITY | portPRIVILEGE_BIT ), but tskIDLE_PRIORITY is zero. */
-									   &xIdleTaskHandle ); /*lint !e961 MISRA exception, justified as it is not a redundant explicit cast to all supported compilers. */
-			}
-			#endif
-		}
-    #endif /* configSUPPORT_STATIC_ALLOCATION */
+            mtCOVERAGE_TEST_MARKER();
+        }
 
-    #if ( configUSE_TIMERS == 1 )
+        if( ulSpeed != ulEDFSpeed )
         {
-            if( xReturn == pdPASS )
-            {
-                xReturn = xTimerCreateTimerTask();
-            }
-            else
-            {
-                mtCOVERAGE_TEST_MARKER();
-            }
+            ulEDFSpeed = ulSpeed;
+            traceEDF_SPEED_CHANGE( ulSpeed );
+            configEDF_DVS_SET_SPEED( ulSpeed );
         }
-    #endif /* configUSE_TIMERS */
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
 
-    if( xReturn == pdPASS )
-    {
-        /* freertos_tasks_c_additions_init() should only be called if the user
-         * definable macro FREERTOS_TASKS_C_ADDITIONS_INIT() is defined, as that is
-         * the only macro called by the function. */
-        #ifdef FREERTOS_TASKS_C_ADDITIONS_INIT
-            {
-                freertos_tasks_c_additions_init();
-            }
-        #endif
+#endif /* ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_DVS == 1 ) */
+/*-----------------------------------------------------------*/
 
-        /* Interrupts are turned off here, to ensure a tick does not occur
-         * before or during the call to xPortStartScheduler().  The stacks of
-         * the created tasks contain a status word with interrupts switched on
-         * so interrupts will automatically get re-enabled when the first task
-         * starts to run. */
-        portDISABLE_INTERRUPTS();
+#if ( INCLUDE_vTaskDelay == 1 )
 
-        #if ( configUSE_NEWLIB_REENTRANT == 1 )
-            {
-                /* Switch Newlib's _impure_ptr variable to point to the _reent
-                 * structure specific to the task that will run first.
-                 * See the third party link http://www.nadler.com/embedded/newlibAndFreeRTOS.html
-                 * for additional information. */
-                _impure_ptr = &( pxCurrentTCB->xNewLib_reent );
-            }
-        #endif /* configUSE_NEWLIB_REENTRANT */
+    void vTaskDelay( const TickType_t xTicksToDelay )
+    {
+        BaseType_t xAlreadyYielded = pdFALSE;
 
-        xNextTaskUnblockTime = portMAX_DELAY;
-        xSchedulerRunning = pdTRUE;
-        xTickCount = ( TickType_t ) configINITIAL_TICK_COUNT;
+        /* A delay time of zero just forces a reschedule. */
+        if( xTicksToDelay > ( TickType_t ) 0U )
+        {
+            configASSERT( uxSchedulerSuspended == 0 );
+            vTaskSuspendAll();
+            {
+                traceTASK_DELAY();
 
-        /* If configGENERATE_RUN_TIME_STATS is defined then the following
-         * macro must be defined to configure the timer/counter used to generate
-         * the run time counter time base.   NOTE:  If configGENERATE_RUN_TIME_STATS
-         * is set to 0 and the following line fails to build then ensure you do not
-         * have portCONFIGURE_TIMER_FOR_RUN_TIME_STATS() defined in your
-         * FreeRTOSConfig.h file. */
-        portCONFIGURE_TIMER_FOR_RUN_TIME_STATS();
+                /* A task that is removed from the event list while the
+                 * scheduler is suspended will not get placed in the ready
+                 * list or removed from the blocked list until the scheduler
+                 * is resumed.
+                 *
+                 * This task cannot be in an event list as it is the currently
+                 * executing task. */
+                prvAddCurrentTaskToDelayedList( xTicksToDelay, pdFALSE );
+            }
+            xAlreadyYielded = xTaskResumeAll();
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
 
-        traceTASK_SWITCHED_IN();
+        /* Force a reschedule if xTaskResumeAll has not already done so, we may
+         * have put ourselves to sleep. */
+        if( xAlreadyYielded == pdFALSE )
+        {
+            portYIELD_WITHIN_API();
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
 
-        /* Setting up the timer tick is hardware specific and thus in the
-         * portable interface. */
-        if( xPortStartScheduler() != pdFALSE )
+#endif /* INCLUDE_vTaskDelay */
+/*-----------------------------------------------------------*/
+
+#if ( ( INCLUDE_eTaskGetState == 1 ) || ( configUSE_TRACE_FACILITY == 1 ) || ( INCLUDE_xTaskAbortDelay == 1 ) )
+
+    eTaskState eTaskGetState( TaskHandle_t xTask )
+    {
+        eTaskState eReturn;
+        List_t const * pxStateList, * pxDelayedList, * pxOverflowedDelayedList;
+        const TCB_t * const pxTCB = xTask;
+
+        configASSERT( pxTCB );
+
+        if( pxTCB == pxCurrentTCB )
         {
-            /* Should not reach here as if the scheduler is running the
-             * function will not return. */
+            /* The task calling this function is querying its own state. */
+            eReturn = eRunning;
         }
         else
         {
-            /* Should only reach here if a task calls xTaskEndScheduler(). */
+            taskENTER_CRITICAL();
+            {
+                pxStateList = listLIST_ITEM_CONTAINER( &( pxTCB->xStateListItem ) );
+                pxDelayedList = pxDelayedTaskList;
+                pxOverflowedDelayedList = pxOverflowDelayedTaskList;
+            }
+            taskEXIT_CRITICAL();
+
+            if( ( pxStateList == pxDelayedList ) || ( pxStateList == pxOverflowedDelayedList ) )
+            {
+                /* The task being queried is referenced from one of the Blocked
+                 * lists. */
+                eReturn = eBlocked;
+            }
+
+            #if ( INCLUDE_vTaskSuspend == 1 )
+                else if( pxStateList == &xSuspendedTaskList )
+                {
+                    /* The task being queried is referenced from the suspended
+                     * list.  Is it genuinely suspended or is it blocked
+                     * indefinitely? */
+                    if( listLIST_ITEM_CONTAINER( &( pxTCB->xEventListItem ) ) == NULL )
+                    {
+                        #if ( configUSE_TASK_NOTIFICATIONS == 1 )
+                            {
+                                BaseType_t x;
+
+                                /* The task does not appear on the event list item of
+                                 * and of the RTOS objects, but could still be in the
+                                 * blocked state if it is waiting on its notification
+                                 * rather than waiting on an object.  If not, is
+                                 * suspended. */
+                                eReturn = eSuspended;
+
+                                for( x = 0; x < configTASK_NOTIFICATION_ARRAY_ENTRIES; x++ )
+                                {
+                                    if( pxTCB->ucNotifyState[ x ] == taskWAITING_NOTIFICATION )
+                                    {
+                                        eReturn = eBlocked;
+                                        break;
+                                    }
+                                }
+                            }
+                        #else /* if ( configUSE_TASK_NOTIFICATIONS == 1 ) */
+                            {
+                                eReturn = eSuspended;
+                            }
+                        #endif /* if ( configUSE_TASK_NOTIFICATIONS == 1 ) */
+                    }
+                    else
+                    {
+                        eReturn = eBlocked;
+                    }
+                }
+            #endif /* if ( INCLUDE_vTaskSuspend == 1 ) */
+
+            #if ( INCLUDE_vTaskDelete == 1 )
+                else if( ( pxStateList == &xTasksWaitingTermination ) || ( pxStateList == NULL ) )
+                {
+                    /* The task being queried is referenced from the deleted
+                     * tasks list, or it is not referenced from any lists at
+                     * all. */
+                    eReturn = eDeleted;
+                }
+            #endif
+
+            else /*lint !e525 Negative indentation is intended to make use of pre-processor clearer. */
+            {
+                /* If the task is not in any other state, it must be in the
+                 * Ready (including pending ready) state. */
+                eReturn = eReady;
+            }
+        }
+
+        return eReturn;
+    } /*lint !e818 xTask cannot be a pointer to const because it is a typedef. */
+
+#endif /* INCLUDE_eTaskGetState */
+/*-----------------------------------------------------------*/
+
+#if ( INCLUDE_uxTaskPriorityGet == 1 )
+
+    UBaseType_t uxTaskPriorityGet( const TaskHandle_t xTask )
+    {
+        TCB_t const * pxTCB;
+        UBaseType_t uxReturn;
+
+        taskENTER_CRITICAL();
+        {
+            /* If null is passed in here then it is the priority of the task
+             * that called uxTaskPriorityGet() that is being queried. */
+            pxTCB = prvGetTCBFromHandle( xTask );
+            uxReturn = pxTCB->uxPriority;
         }
+        taskEXIT_CRITICAL();
+
+        return uxReturn;
     }
-    else
+
+#endif /* INCLUDE_uxTaskPriorityGet */
+/*-----------------------------------------------------------*/
+
+#if ( INCLUDE_uxTaskPriorityGet == 1 )
+
+    UBaseType_t uxTaskPriorityGetFromISR( const TaskHandle_t xTask )
     {
-        /* This line will only be reached if the kernel could not be started,
-         * because there was not enough FreeRTOS heap to create the idle task
-         * or the timer task. */
-        configASSERT( xReturn != errCOULD_NOT_ALLOCATE_REQUIRED_MEMORY );
+        TCB_t const * pxTCB;
+        UBaseType_t uxReturn, uxSavedInterruptState;
+
+        /* RTOS ports that support interrupt nesting have the concept of a
+         * maximum  system call (or maximum API call) interrupt priority.
+         * Interrupts that are  above the maximum system call priority are keep
+         * permanently enabled, even when the RTOS kernel is in a critical section,
+         * but cannot make any calls to FreeRTOS API functions.  If configASSERT()
+         * is defined in FreeRTOSConfig.h then
+         * portASSERT_IF_INTERRUPT_PRIORITY_INVALID() will result in an assertion
+         * failure if a FreeRTOS API function is called from an interrupt that has
+         * been assigned a priority above the configured maximum system call
+         * priority.  Only FreeRTOS functions that end in FromISR can be called
+         * from interrupts  that have been assigned a priority at or (logically)
+         * below the maximum system call interrupt priority.  FreeRTOS maintains a
+         * separate interrupt safe API to ensure interrupt entry is as fast and as
+         * simple as possible.  More information (albeit Cortex-M specific) is
+         * provided on the following link:
+         * https://www.FreeRTOS.org/RTOS-Cortex-M3-M4.html */
+        portASSERT_IF_INTERRUPT_PRIORITY_INVALID();
+
+        uxSavedInterruptState = portSET_INTERRUPT_MASK_FROM_ISR();
+        {
+            /* If null is passed in here then it is the priority of the calling
+             * task that is being queried. */
+            pxTCB = prvGetTCBFromHandle( xTask );
+            uxReturn = pxTCB->uxPriority;
+        }
+        portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptState );
+
+        return uxReturn;
     }
 
-    /* Prevent compiler warnings if INCLUDE_xTaskGetIdleTaskHandle is set to 0,
-     * meaning xIdleTaskHandle is not used anywhere else. */
-    ( void ) xIdleTaskHandle;
+#endif /* INCLUDE_uxTaskPriorityGet */
+/*-----------------------------------------------------------*/
 
-    /* OpenOCD makes use of uxTopUsedPriority for thread debugging. Prevent uxTopUsedPriority
-     * from getting optimized out as it is no longer used by the kernel. */
-    ( void ) uxTopUsedPriority;
-}
+#if ( INCLUDE_vTaskPrioritySet == 1 )
+
+    void vTaskPrioritySet( TaskHandle_t xTask,
+                           UBaseType_t uxNewPriority )
+    {
+        TCB_t * pxTCB;
+        UBaseType_t uxCurrentBasePriority, uxPriorityUsedOnEntry;
+        BaseType_t xYieldRequired = pdFALSE;
+
+        configASSERT( uxNewPriority < configMAX_PRIORITIES );
+
+        /* Ensure the new priority is valid. */
+        if( uxNewPriority >= ( UBaseType_t ) configMAX_PRIORITIES )
+        {
+            uxNewPriority = ( UBaseType_t ) configMAX_PRIORITIES - ( UBaseType_t ) 1U;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        taskENTER_CRITICAL();
+        {
+            /* If null is passed in here then it is the priority of the calling
+             * task that is being changed. */
+            pxTCB = prvGetTCBFromHandle( xTask );
+
+            traceTASK_PRIORITY_SET( pxTCB, uxNewPriority );
+
+            #if ( configUSE_MUTEXES == 1 )
+                {
+                    uxCurrentBasePriority = pxTCB->uxBasePriority;
+                }
+            #else
+                {
+                    uxCurrentBasePriority = pxTCB->uxPriority;
+                }
+            #endif
+
+            if( uxCurrentBasePriority != uxNewPriority )
+            {
+                /* The priority change may have readied a task of higher
+                 * priority than the calling task. */
+                if( uxNewPriority > uxCurrentBasePriority )
+                {
+                    if( pxTCB != pxCurrentTCB )
+                    {
+                        /* The priority of a task other than the currently
+                         * running task is being raised.  Is the priority being
+                         * raised above that of the running task? */
+                        if( uxNewPriority >= pxCurrentTCB->uxPriority )
+                        {
+                            xYieldRequired = pdTRUE;
+                        }
+                        else
+                        {
+                            mtCOVERAGE_TEST_MARKER();
+                        }
+                    }
+                    else
+                    {
+                        /* The priority of the running task is being raised,
+                         * but the running task must already be the highest
+                         * priority task able to run so no yield is required. */
+                    }
+                }
+                else if( pxTCB == pxCurrentTCB )
+                {
+                    /* Setting the priority of the running task down means
+                     * there may now be another task of higher priority that
+                     * is ready to execute. */
+                    xYieldRequired = pdTRUE;
+                }
+                else
+                {
+                    /* Setting the priority of any other task down does not
+                     * require a yield as the running task must be above the
+                     * new priority of the task being modified. */
+                }
+
+                /* Remember the ready list the task might be referenced from
+                 * before its uxPriority member is changed so the
+                 * taskRESET_READY_PRIORITY() macro can function correctly. */
+                uxPriorityUsedOnEntry = pxTCB->uxPriority;
+
+                #if ( configUSE_MUTEXES == 1 )
+                    {
+                        /* Only change the priority being used if the task is not
+                         * currently using an inherited priority. */
+                        if( pxTCB->uxBasePriority == pxTCB->uxPriority )
+                        {
+                            pxTCB->uxPriority = uxNewPriority;
+                        }
+                        else
+                        {
+                            mtCOVERAGE_TEST_MARKER();
+                        }
+
+                        /* The base priority gets set whatever. */
+                        pxTCB->uxBasePriority = uxNewPriority;
+                    }
+                #else /* if ( configUSE_MUTEXES == 1 ) */
+                    {
+                        pxTCB->uxPriority = uxNewPriority;
+                    }
+                #endif /* if ( configUSE_MUTEXES == 1 ) */
+
+                /* Only reset the event list item value if the value is not
+                 * being used for anything else. */
+                if( ( listGET_LIST_ITEM_VALUE( &( pxTCB->xEventListItem ) ) & taskEVENT_LIST_ITEM_VALUE_IN_USE ) == 0UL )
+                {
+                    listSET_LIST_ITEM_VALUE( &( pxTCB->xEventListItem ), ( ( TickType_t ) configMAX_PRIORITIES - ( TickType_t ) uxNewPriority ) ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+
+                /* If the task is in the blocked or suspended list we need do
+                 * nothing more than change its priority variable. However, if
+                 * the task is in a ready list it needs to be removed and placed
+                 * in the list appropriate to its new priority. */
+                if( listIS_CONTAINED_WITHIN( &( pxReadyTasksLists[ uxPriorityUsedOnEntry ] ), &( pxTCB->xStateListItem ) ) != pdFALSE )
+                {
+                    /* The task is currently in its ready list - remove before
+                     * adding it to its new ready list.  As we are in a critical
+                     * section we can do this even if the scheduler is suspended. */
+                    if( uxListRemove( &( pxTCB->xStateListItem ) ) == ( UBaseType_t ) 0 )
+                    {
+                        /* It is known that the task is in its ready list so
+                         * there is no need to check again and the port level
+                         * reset macro can be called directly. */
+                        portRESET_READY_PRIORITY( uxPriorityUsedOnEntry, uxTopReadyPriority );
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+
+                    prvAddTaskToReadyList( pxTCB );
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+
+                if( xYieldRequired != pdFALSE )
+                {
+                    taskYIELD_IF_USING_PREEMPTION();
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+
+                /* Remove compiler warning about unused variables when the port
+                 * optimised task selection is not being used. */
+                ( void ) uxPriorityUsedOnEntry;
+            }
+        }
+        taskEXIT_CRITICAL();
+    }
+
+#endif /* INCLUDE_vTaskPrioritySet */
+/*-----------------------------------------------------------*/
+
+#if ( INCLUDE_vTaskSuspend == 1 )
+
+    void vTaskSuspend( TaskHandle_t xTaskToSuspend )
+    {
+        TCB_t * pxTCB;
+
+        taskENTER_CRITICAL();
+        {
+            /* If null is passed in here then it is the running task that is
+             * being suspended. */
+            pxTCB = prvGetTCBFromHandle( xTaskToSuspend );
+
+            traceTASK_SUSPEND( pxTCB );
+
+            /* Remove task from the ready/delayed list and place in the
+             * suspended list. */
+            if( uxListRemove( &( pxTCB->xStateListItem ) ) == ( UBaseType_t ) 0 )
+            {
+                taskRESET_READY_PRIORITY( pxTCB->uxPriority );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            /* Is the task waiting on an event also? */
+            if( listLIST_ITEM_CONTAINER( &( pxTCB->xEventListItem ) ) != NULL )
+            {
+                ( void ) uxListRemove( &( pxTCB->xEventListItem ) );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            vListInsertEnd( &xSuspendedTaskList, &( pxTCB->xStateListItem ) );
+
+            #if ( configUSE_TASK_NOTIFICATIONS == 1 )
+                {
+                    BaseType_t x;
+
+                    for( x = 0; x < configTASK_NOTIFICATION_ARRAY_ENTRIES; x++ )
+                    {
+                        if( pxTCB->ucNotifyState[ x ] == taskWAITING_NOTIFICATION )
+                        {
+                            /* The task was blocked to wait for a notification, but is
+                             * now suspended, so no notification was received. */
+                            pxTCB->ucNotifyState[ x ] = taskNOT_WAITING_NOTIFICATION;
+                        }
+                    }
+                }
+            #endif /* if ( configUSE_TASK_NOTIFICATIONS == 1 ) */
+        }
+        taskEXIT_CRITICAL();
+
+        if( xSchedulerRunning != pdFALSE )
+        {
+            /* Reset the next expected unblock time in case it referred to the
+             * task that is now in the Suspended state. */
+            taskENTER_CRITICAL();
+            {
+                prvResetNextTaskUnblockTime();
+            }
+            taskEXIT_CRITICAL();
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        if( pxTCB == pxCurrentTCB )
+        {
+            if( xSchedulerRunning != pdFALSE )
+            {
+                /* The current task has just been suspended. */
+                configASSERT( uxSchedulerSuspended == 0 );
+                portYIELD_WITHIN_API();
+            }
+            else
+            {
+                /* The scheduler is not running, but the task that was pointed
+                 * to by pxCurrentTCB has just been suspended and pxCurrentTCB
+                 * must be adjusted to point to a different task. */
+                if( listCURRENT_LIST_LENGTH( &xSuspendedTaskList ) == uxCurrentNumberOfTasks ) /*lint !e931 Right has no side effect, just volatile. */
+                {
+                    /* No other tasks are ready, so set pxCurrentTCB back to
+                     * NULL so when the next task is created pxCurrentTCB will
+                     * be set to point to it no matter what its relative priority
+                     * is. */
+                    pxCurrentTCB = NULL;
+                }
+                else
+                {
+                    vTaskSwitchContext();
+                }
+            }
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+
+#endif /* INCLUDE_vTaskSuspend */
+/*-----------------------------------------------------------*/
+
+#if ( INCLUDE_vTaskSuspend == 1 )
+
+    static BaseType_t prvTaskIsTaskSuspended( const TaskHandle_t xTask )
+    {
+        BaseType_t xReturn = pdFALSE;
+        const TCB_t * const pxTCB = xTask;
+
+        /* Accesses xPendingReadyList so must be called from a critical
+         * section. */
+
+        /* It does not make sense to check if the calling task is suspended. */
+        configASSERT( xTask );
+
+        /* Is the task being resumed actually in the suspended list? */
+        if( listIS_CONTAINED_WITHIN( &xSuspendedTaskList, &( pxTCB->xStateListItem ) ) != pdFALSE )
+        {
+            /* Has the task already been resumed from within an ISR? */
+            if( listIS_CONTAINED_WITHIN( &xPendingReadyList, &( pxTCB->xEventListItem ) ) == pdFALSE )
+            {
+                /* Is it in the suspended list because it is in the Suspended
+                 * state, or because is is blocked with no timeout? */
+                if( listIS_CONTAINED_WITHIN( NULL, &( pxTCB->xEventListItem ) ) != pdFALSE ) /*lint !e961.  The cast is only redundant when NULL is used. */
+                {
+                    xReturn = pdTRUE;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        return xReturn;
+    } /*lint !e818 xTask cannot be a pointer to const because it is a typedef. */
+
+#endif /* INCLUDE_vTaskSuspend */
+/*-----------------------------------------------------------*/
+
+#if ( INCLUDE_vTaskSuspend == 1 )
+
+    void vTaskResume( TaskHandle_t xTaskToResume )
+    {
+        TCB_t * const pxTCB = xTaskToResume;
+
+        /* It does not make sense to resume the calling task. */
+        configASSERT( xTaskToResume );
+
+        /* The parameter cannot be NULL as it is impossible to resume the
+         * currently executing task. */
+        if( ( pxTCB != pxCurrentTCB ) && ( pxTCB != NULL ) )
+        {
+            taskENTER_CRITICAL();
+            {
+                if( prvTaskIsTaskSuspended( pxTCB ) != pdFALSE )
+                {
+                    traceTASK_RESUME( pxTCB );
+
+                    /* The ready list can be accessed even if the scheduler is
+                     * suspended because this is inside a critical section. */
+                    ( void ) uxListRemove( &( pxTCB->xStateListItem ) );
+                    prvAddTaskToReadyList( pxTCB );
+
+                    /* A higher priority task may have just been resumed. */
+                    if( pxTCB->uxPriority >= pxCurrentTCB->uxPriority )
+                    {
+                        /* This yield may not cause the task just resumed to run,
+                         * but will leave the lists in the correct state for the
+                         * next yield. */
+                        taskYIELD_IF_USING_PREEMPTION();
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            taskEXIT_CRITICAL();
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+
+#endif /* INCLUDE_vTaskSuspend */
+
+/*-----------------------------------------------------------*/
+
+#if ( ( INCLUDE_xTaskResumeFromISR == 1 ) && ( INCLUDE_vTaskSuspend == 1 ) )
+
+    BaseType_t xTaskResumeFromISR( TaskHandle_t xTaskToResume )
+    {
+        BaseType_t xYieldRequired = pdFALSE;
+        TCB_t * const pxTCB = xTaskToResume;
+        UBaseType_t uxSavedInterruptStatus;
+
+        configASSERT( xTaskToResume );
+
+        /* RTOS ports that support interrupt nesting have the concept of a
+         * maximum  system call (or maximum API call) interrupt priority.
+         * Interrupts that are  above the maximum system call priority are keep
+         * permanently enabled, even when the RTOS kernel is in a critical section,
+         * but cannot make any calls to FreeRTOS API functions.  If configASSERT()
+         * is defined in FreeRTOSConfig.h then
+         * portASSERT_IF_INTERRUPT_PRIORITY_INVALID() will result in an assertion
+         * failure if a FreeRTOS API function is called from an interrupt that has
+         * been assigned a priority above the configured maximum system call
+         * priority.  Only FreeRTOS functions that end in FromISR can be called
+         * from interrupts  that have been assigned a priority at or (logically)
+         * below the maximum system call interrupt priority.  FreeRTOS maintains a
+         * separate interrupt safe API to ensure interrupt entry is as fast and as
+         * simple as possible.  More information (albeit Cortex-M specific) is
+         * provided on the following link:
+         * https://www.FreeRTOS.org/RTOS-Cortex-M3-M4.html */
+        portASSERT_IF_INTERRUPT_PRIORITY_INVALID();
+
+        uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+        {
+            if( prvTaskIsTaskSuspended( pxTCB ) != pdFALSE )
+            {
+                traceTASK_RESUME_FROM_ISR( pxTCB );
+
+                /* Check the ready lists can be accessed. */
+                if( uxSchedulerSuspended == ( UBaseType_t ) pdFALSE )
+                {
+                    /* Ready lists can be accessed so move the task from the
+                     * suspended list to the ready list directly. */
+                    if( pxTCB->uxPriority >= pxCurrentTCB->uxPriority )
+                    {
+                        xYieldRequired = pdTRUE;
+
+                        /* Mark that a yield is pending in case the user is not
+                         * using the return value to initiate a context switch
+                         * from the ISR using portYIELD_FROM_ISR. */
+                        xYieldPending = pdTRUE;
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+
+                    ( void ) uxListRemove( &( pxTCB->xStateListItem ) );
+                    prvAddTaskToReadyList( pxTCB );
+                }
+                else
+                {
+                    /* The delayed or ready lists cannot be accessed so the task
+                     * is held in the pending ready list until the scheduler is
+                     * unsuspended. */
+                    vListInsertEnd( &( xPendingReadyList ), &( pxTCB->xEventListItem ) );
+                }
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+
+        return xYieldRequired;
+    }
+
+#endif /* ( ( INCLUDE_xTaskResumeFromISR == 1 ) && ( INCLUDE_vTaskSuspend == 1 ) ) */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_EDF_SCHEDULER == 1 )
+
+    static TickType_t prvEDFIdlePeriod( void )
+    {
+        const ListItem_t * pxEnd = listGET_END_MARKER( &xReadyTasksListEDF );
+        ListItem_t * pxItem;
+        TCB_t * pxTCB;
+        TickType_t xPeriod = ( TickType_t ) 200U;
+
+        for( pxItem = listGET_HEAD_ENTRY( &xReadyTasksListEDF ); pxItem != pxEnd; pxItem = listGET_NEXT( pxItem ) )
+        {
+            pxTCB = listGET_LIST_ITEM_OWNER( pxItem );
+
+            if( pxTCB->xTaskPeriod > xPeriod )
+            {
+                xPeriod = pxTCB->xTaskPeriod;
+            }
+
+            #if ( configUSE_EDF_ELASTIC == 1 )
+                {
+                    if( pxTCB->xTaskPeriodMax > xPeriod )
+                    {
+                        xPeriod = pxTCB->xTaskPeriodMax;
+                    }
+                }
+            #endif
+        }
+
+        return xPeriod;
+    }
+
+#endif /* configUSE_EDF_SCHEDULER */
+/*-----------------------------------------------------------*/
+
+void vTaskStartScheduler( void )
+{
+    BaseType_t xReturn;
+
+    /* Add the idle task at the lowest priority. */
+    #if ( ( configSUPPORT_STATIC_ALLOCATION == 1 ) && ( configUSE_EDF_SCHEDULER == 1 ) )
+        {
+            /*E.C. : the idle task is periodic too, and needs a TCB buffer
+             * large enough for the EDF members. */
+            StaticEDFTask_t * pxIdleTaskTCBBuffer = NULL;
+            StackType_t * pxIdleTaskStackBuffer = NULL;
+            uint32_t ulIdleTaskStackSize;
+            TickType_t initIDLEPeriod = prvEDFIdlePeriod();
+
+            vApplicationGetEDFIdleTaskMemory( &pxIdleTaskTCBBuffer, &pxIdleTaskStackBuffer, &ulIdleTaskStackSize );
+            xIdleTaskHandle = xTaskPeriodicCreateStatic( prvIdleTask,
+                                                         configIDLE_TASK_NAME,
+                                                         ulIdleTaskStackSize,
+                                                         ( void * ) NULL,
+                                                         portPRIVILEGE_BIT,
+                                                         pxIdleTaskStackBuffer,
+                                                         pxIdleTaskTCBBuffer,
+                                                         initIDLEPeriod );
+
+            if( xIdleTaskHandle != NULL )
+            {
+                xReturn = pdPASS;
+            }
+            else
+            {
+                xReturn = pdFAIL;
+            }
+        }
+    #elif ( configSUPPORT_STATIC_ALLOCATION == 1 )
+        {
+            StaticTask_t * pxIdleTaskTCBBuffer = NULL;
+            StackType_t * pxIdleTaskStackBuffer = NULL;
+            uint32_t ulIdleTaskStackSize;
+
+            /* The Idle task is created using user provided RAM - obtain the
+             * address of the RAM then create the idle task. */
+            vApplicationGetIdleTaskMemory( &pxIdleTaskTCBBuffer, &pxIdleTaskStackBuffer, &ulIdleTaskStackSize );
+            xIdleTaskHandle = xTaskCreateStatic( prvIdleTask,
+                                                 configIDLE_TASK_NAME,
+                                                 ulIdleTaskStackSize,
+                                                 ( void * ) NULL,       /*lint !e961.  The cast is not redundant for all compilers. */
+                                                 portPRIVILEGE_BIT,     /* In effect ( tskIDLE_PRIORITY | portPRIVILEGE_BIT ), but tskIDLE_PRIORITY is zero. */
+                                                 pxIdleTaskStackBuffer,
+                                                 pxIdleTaskTCBBuffer ); /*lint !e961 MISRA exception, justified as it is not a redundant explicit cast to all supported compilers. */
+
+            if( xIdleTaskHandle != NULL )
+            {
+                xReturn = pdPASS;
+            }
+            else
+            {
+                xReturn = pdFAIL;
+            }
+        }
+    #else /* if ( configSUPPORT_STATIC_ALLOCATION == 1 ) */
+        {
+	//////////////////////////////*********************************/////////////////////////////				
+			/*E.C. : */
+			#if (configUSE_EDF_SCHEDULER == 1)
+			{
+				TickType_t initIDLEPeriod = prvEDFIdlePeriod();
+				xReturn = xTaskPeriodicCreate( 	prvIdleTask,
+												"IDLE",
+												configMINIMAL_STACK_SIZE, 
+												(void * ) NULL, 
+												0,
+												&xIdleTaskHandle,
+												initIDLEPeriod );
+			}
+			#else
+            {
+				/* The Idle task is being created using dynamically allocated RAM. */
+				xReturn = xTaskCreate( prvIdleTask,
+									   configIDLE_TASK_NAME,
+									   configMINIMAL_STACK_SIZE,
+									   ( void * ) NULL,
+									   (tskIDLE_PRIORITY|portPRIVILEGE_BIT),  /* In effect ( tskIDLE_PRIORITY | portPRIVILEGE_BIT ), but tskIDLE_PRIORITY is zero. */
+									   &xIdleTaskHandle ); /*lint !e961 MISRA exception, justified as it is not a redundant explicit cast to all supported compilers. */
+			}
+			#endif
+		}
+    #endif /* configSUPPORT_STATIC_ALLOCATION */
+
+    #if ( configUSE_TIMERS == 1 )
+        {
+            if( xReturn == pdPASS )
+            {
+                xReturn = xTimerCreateTimerTask();
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+    #endif /* configUSE_TIMERS */
+
+    if( xReturn == pdPASS )
+    {
+        /* freertos_tasks_c_additions_init() should only be called if the user
+         * definable macro FREERTOS_TASKS_C_ADDITIONS_INIT() is defined, as that is
+         * the only macro called by the function. */
+        #ifdef FREERTOS_TASKS_C_ADDITIONS_INIT
+            {
+                freertos_tasks_c_additions_init();
+            }
+        #endif
+
+        /* Interrupts are turned off here, to ensure a tick does not occur
+         * before or during the call to xPortStartScheduler().  The stacks of
+         * the created tasks contain a status word with interrupts switched on
+         * so interrupts will automatically get re-enabled when the first task
+         * starts to run. */
+        portDISABLE_INTERRUPTS();
+
+        #if ( configUSE_NEWLIB_REENTRANT == 1 )
+            {
+                /* Switch Newlib's _impure_ptr variable to point to the _reent
+                 * structure specific to the task that will run first.
+                 * See the third party link http://www.nadler.com/embedded/newlibAndFreeRTOS.html
+                 * for additional information. */
+                _impure_ptr = &( pxCurrentTCB->xNewLib_reent );
+            }
+        #endif /* configUSE_NEWLIB_REENTRANT */
+
+        xNextTaskUnblockTime = portMAX_DELAY;
+        xSchedulerRunning = pdTRUE;
+        xTickCount = ( TickType_t ) configINITIAL_TICK_COUNT;
+
+        /* If configGENERATE_RUN_TIME_STATS is defined then the following
+         * macro must be defined to configure the timer/counter used to generate
+         * the run time counter time base.   NOTE:  If configGENERATE_RUN_TIME_STATS
+         * is set to 0 and the following line fails to build then ensure you do not
+         * have portCONFIGURE_TIMER_FOR_RUN_TIME_STATS() defined in your
+         * FreeRTOSConfig.h file. */
+        portCONFIGURE_TIMER_FOR_RUN_TIME_STATS();
+
+        #if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_UTILIZATION == 1 ) )
+            {
+                ulEDFSwitchedInTime = configEDF_TIMESTAMP();
+                ulEDFWindowStartTime = ulEDFSwitchedInTime;
+                xEDFWindowStartTick = xTickCount;
+            }
+        #endif
+
+        taskEDF_RECORD_JOB_START();
+        taskEDF_HOLD_THRESHOLD();
+        traceTASK_SWITCHED_IN();
+
+        /* Setting up the timer tick is hardware specific and thus in the
+         * portable interface. */
+        if( xPortStartScheduler() != pdFALSE )
+        {
+            /* Should not reach here as if the scheduler is running the
+             * function will not return. */
+        }
+        else
+        {
+            /* Should only reach here if a task calls xTaskEndScheduler(). */
+        }
+    }
+    else
+    {
+        /* This line will only be reached if the kernel could not be started,
+         * because there was not enough FreeRTOS heap to create the idle task
+         * or the timer task. */
+        configASSERT( xReturn != errCOULD_NOT_ALLOCATE_REQUIRED_MEMORY );
+    }
+
+    /* Prevent compiler warnings if INCLUDE_xTaskGetIdleTaskHandle is set to 0,
+     * meaning xIdleTaskHandle is not used anywhere else. */
+    ( void ) xIdleTaskHandle;
+
+    /* OpenOCD makes use of uxTopUsedPriority for thread debugging. Prevent uxTopUsedPriority
+     * from getting optimized out as it is no longer used by the kernel. */
+    ( void ) uxTopUsedPriority;
+}
+/*-----------------------------------------------------------*/
+
+void vTaskEndScheduler( void )
+{
+    /* Stop the scheduler interrupts and call the portable scheduler end
+     * routine so the original ISRs can be restored if necessary.  The port
+     * layer must ensure interrupts enable  bit is left in the correct state. */
+    portDISABLE_INTERRUPTS();
+    xSchedulerRunning = pdFALSE;
+    vPortEndScheduler();
+}
+/*----------------------------------------------------------*/
+
+void vTaskSuspendAll( void )
+{
+    /* A critical section is not required as the variable is of type
+     * BaseType_t.  Please read Richard Barry's reply in the following link to a
+     * post in the FreeRTOS support forum before reporting this as a bug! -
+     * https://goo.gl/wu4acr */
+
+    /* portSOFTWARE_BARRIER() is only implemented for emulated/simulated ports that
+     * do not otherwise exhibit real time behaviour. */
+    portSOFTWARE_BARRIER();
+
+    /* The scheduler is suspended if uxSchedulerSuspended is non-zero.  An increment
+     * is used to allow calls to vTaskSuspendAll() to nest. */
+    ++uxSchedulerSuspended;
+
+    /* Enforces ordering for ports and optimised compilers that may otherwise place
+     * the above increment elsewhere. */
+    portMEMORY_BARRIER();
+}
+/*----------------------------------------------------------*/
+
+#if ( configUSE_TICKLESS_IDLE != 0 )
+
+    static TickType_t prvGetExpectedIdleTime( void )
+    {
+        TickType_t xReturn;
+        UBaseType_t uxHigherPriorityReadyTasks = pdFALSE;
+
+        /* uxHigherPriorityReadyTasks takes care of the case where
+         * configUSE_PREEMPTION is 0, so there may be tasks above the idle priority
+         * task that are in the Ready state, even though the idle task is
+         * running. */
+        #if ( configUSE_PORT_OPTIMISED_TASK_SELECTION == 0 )
+            {
+                if( uxTopReadyPriority > tskIDLE_PRIORITY )
+                {
+                    uxHigherPriorityReadyTasks = pdTRUE;
+                }
+            }
+        #else
+            {
+                const UBaseType_t uxLeastSignificantBit = ( UBaseType_t ) 0x01;
+
+                /* When port optimised task selection is used the uxTopReadyPriority
+                 * variable is used as a bit map.  If bits other than the least
+                 * significant bit are set then there are tasks that have a priority
+                 * above the idle priority that are in the Ready state.  This takes
+                 * care of the case where the co-operative scheduler is in use. */
+                if( uxTopReadyPriority > uxLeastSignificantBit )
+                {
+                    uxHigherPriorityReadyTasks = pdTRUE;
+                }
+            }
+        #endif /* if ( configUSE_PORT_OPTIMISED_TASK_SELECTION == 0 ) */
+
+        if( pxCurrentTCB->uxPriority > tskIDLE_PRIORITY )
+        {
+            xReturn = 0;
+        }
+        else if( listCURRENT_LIST_LENGTH( &( pxReadyTasksLists[ tskIDLE_PRIORITY ] ) ) > 1 )
+        {
+            /* There are other idle priority tasks in the ready state.  If
+             * time slicing is used then the very next tick interrupt must be
+             * processed. */
+            xReturn = 0;
+        }
+        else if( uxHigherPriorityReadyTasks != pdFALSE )
+        {
+            /* There are tasks in the Ready state that have a priority above the
+             * idle priority.  This path can only be reached if
+             * configUSE_PREEMPTION is 0. */
+            xReturn = 0;
+        }
+        else
+        {
+            xReturn = xNextTaskUnblockTime - xTickCount;
+        }
+
+        return xReturn;
+    }
+
+#endif /* configUSE_TICKLESS_IDLE */
+/*----------------------------------------------------------*/
+
+BaseType_t xTaskResumeAll( void )
+{
+    TCB_t * pxTCB = NULL;
+    BaseType_t xAlreadyYielded = pdFALSE;
+
+    /* If uxSchedulerSuspended is zero then this function does not match a
+     * previous call to vTaskSuspendAll(). */
+    configASSERT( uxSchedulerSuspended );
+
+    /* It is possible that an ISR caused a task to be removed from an event
+     * list while the scheduler was suspended.  If this was the case then the
+     * removed task will have been added to the xPendingReadyList.  Once the
+     * scheduler has been resumed it is safe to move all the pending ready
+     * tasks from this list into their appropriate ready list. */
+    taskENTER_CRITICAL();
+    {
+        --uxSchedulerSuspended;
+
+        if( uxSchedulerSuspended == ( UBaseType_t ) pdFALSE )
+        {
+            if( uxCurrentNumberOfTasks > ( UBaseType_t ) 0U )
+            {
+                /* Move any readied tasks from the pending list into the
+                 * appropriate ready list. */
+                while( listLIST_IS_EMPTY( &xPendingReadyList ) == pdFALSE )
+                {
+                    pxTCB = listGET_OWNER_OF_HEAD_ENTRY( ( &xPendingReadyList ) ); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
+                    listREMOVE_ITEM( &( pxTCB->xEventListItem ) );
+                    portMEMORY_BARRIER();
+                    listREMOVE_ITEM( &( pxTCB->xStateListItem ) );
+                    prvAddTaskToReadyList( pxTCB );
+
+                    /* If the moved task has a priority higher than or equal to
+                     * the current task then a yield must be performed.  E.C. :
+                     * under EDF only if it preempts as it would have from the
+                     * interrupt that released it, and not inside the
+                     * non-preemptive region of the running job. */
+                    #if ( configUSE_EDF_SCHEDULER == 1 )
+                        if( taskEDF_PREEMPTS( pxTCB ) && taskEDF_ABOVE_THRESHOLD( pxTCB ) && ( taskEDF_DEFER_PREEMPTION() == pdFALSE ) )
+                    #else
+                        if( pxTCB->uxPriority >= pxCurrentTCB->uxPriority )
+                    #endif
+                    {
+                        xYieldPending = pdTRUE;
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+
+                if( pxTCB != NULL )
+                {
+                    /* A task was unblocked while the scheduler was suspended,
+                     * which may have prevented the next unblock time from being
+                     * re-calculated, in which case re-calculate it now.  Mainly
+                     * important for low power tickless implementations, where
+                     * this can prevent an unnecessary exit from low power
+                     * state. */
+                    prvResetNextTaskUnblockTime();
+                }
+
+                /* If any ticks occurred while the scheduler was suspended then
+                 * they should be processed now.  This ensures the tick count does
+                 * not  slip, and that any delayed tasks are resumed at the correct
+                 * time. */
+                {
+                    TickType_t xPendedCounts = xPendedTicks; /* Non-volatile copy. */
+
+                    if( xPendedCounts > ( TickType_t ) 0U )
+                    {
+                        do
+                        {
+                            if( xTaskIncrementTick() != pdFALSE )
+                            {
+                                xYieldPending = pdTRUE;
+                            }
+                            else
+                            {
+                                mtCOVERAGE_TEST_MARKER();
+                            }
+
+                            --xPendedCounts;
+                        } while( xPendedCounts > ( TickType_t ) 0U );
+
+                        xPendedTicks = 0;
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+
+                if( xYieldPending != pdFALSE )
+                {
+                    #if ( configUSE_PREEMPTION != 0 )
+                        {
+                            xAlreadyYielded = pdTRUE;
+                        }
+                    #endif
+                    taskYIELD_IF_USING_PREEMPTION();
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+    taskEXIT_CRITICAL();
+
+    return xAlreadyYielded;
+}
+/*-----------------------------------------------------------*/
+
+TickType_t xTaskGetTickCount( void )
+{
+    TickType_t xTicks;
+
+    /* Critical section required if running on a 16 bit processor. */
+    portTICK_TYPE_ENTER_CRITICAL();
+    {
+        xTicks = xTickCount;
+    }
+    portTICK_TYPE_EXIT_CRITICAL();
+
+    return xTicks;
+}
+/*-----------------------------------------------------------*/
+
+TickType_t xTaskGetTickCountFromISR( void )
+{
+    TickType_t xReturn;
+    UBaseType_t uxSavedInterruptStatus;
+
+    /* RTOS ports that support interrupt nesting have the concept of a maximum
+     * system call (or maximum API call) interrupt priority.  Interrupts that are
+     * above the maximum system call priority are kept permanently enabled, even
+     * when the RTOS kernel is in a critical section, but cannot make any calls to
+     * FreeRTOS API functions.  If configASSERT() is defined in FreeRTOSConfig.h
+     * then portASSERT_IF_INTERRUPT_PRIORITY_INVALID() will result in an assertion
+     * failure if a FreeRTOS API function is called from an interrupt that has been
+     * assigned a priority above the configured maximum system call priority.
+     * Only FreeRTOS functions that end in FromISR can be called from interrupts
+     * that have been assigned a priority at or (logically) below the maximum
+     * system call  interrupt priority.  FreeRTOS maintains a separate interrupt
+     * safe API to ensure interrupt entry is as fast and as simple as possible.
+     * More information (albeit Cortex-M specific) is provided on the following
+     * link: https://www.FreeRTOS.org/RTOS-Cortex-M3-M4.html */
+    portASSERT_IF_INTERRUPT_PRIORITY_INVALID();
+
+    uxSavedInterruptStatus = portTICK_TYPE_SET_INTERRUPT_MASK_FROM_ISR();
+    {
+        xReturn = xTickCount;
+    }
+    portTICK_TYPE_CLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+
+    return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+UBaseType_t uxTaskGetNumberOfTasks( void )
+{
+    /* A critical section is not required because the variables are of type
+     * BaseType_t. */
+    return uxCurrentNumberOfTasks;
+}
+/*-----------------------------------------------------------*/
+
+char * pcTaskGetName( TaskHandle_t xTaskToQuery ) /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+{
+    TCB_t * pxTCB;
+
+    /* If null is passed in here then the name of the calling task is being
+     * queried. */
+    pxTCB = prvGetTCBFromHandle( xTaskToQuery );
+    configASSERT( pxTCB );
+    return &( pxTCB->pcTaskName[ 0 ] );
+}
+/*-----------------------------------------------------------*/
+
+#if ( INCLUDE_xTaskGetHandle == 1 )
+
+    static TCB_t * prvSearchForNameWithinSingleList( List_t * pxList,
+                                                     const char pcNameToQuery[] )
+    {
+        TCB_t * pxNextTCB, * pxFirstTCB, * pxReturn = NULL;
+        UBaseType_t x;
+        char cNextChar;
+        BaseType_t xBreakLoop;
+
+        /* This function is called with the scheduler suspended. */
+
+        if( listCURRENT_LIST_LENGTH( pxList ) > ( UBaseType_t ) 0 )
+        {
+            listGET_OWNER_OF_NEXT_ENTRY( pxFirstTCB, pxList ); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
+
+            do
+            {
+                listGET_OWNER_OF_NEXT_ENTRY( pxNextTCB, pxList ); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
+
+                /* Check each character in the name looking for a match or
+                 * mismatch. */
+                xBreakLoop = pdFALSE;
+
+                for( x = ( UBaseType_t ) 0; x < ( UBaseType_t ) configMAX_TASK_NAME_LEN; x++ )
+                {
+                    cNextChar = pxNextTCB->pcTaskName[ x ];
+
+                    if( cNextChar != pcNameToQuery[ x ] )
+                    {
+                        /* Characters didn't match. */
+                        xBreakLoop = pdTRUE;
+                    }
+                    else if( cNextChar == ( char ) 0x00 )
+                    {
+                        /* Both strings terminated, a match must have been
+                         * found. */
+                        pxReturn = pxNextTCB;
+                        xBreakLoop = pdTRUE;
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+
+                    if( xBreakLoop != pdFALSE )
+                    {
+                        break;
+                    }
+                }
+
+                if( pxReturn != NULL )
+                {
+                    /* The handle has been found. */
+                    break;
+                }
+            } while( pxNextTCB != pxFirstTCB );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        return pxReturn;
+    }
+
+#endif /* INCLUDE_xTaskGetHandle */
+/*-----------------------------------------------------------*/
+
+#if ( INCLUDE_xTaskGetHandle == 1 )
+
+    TaskHandle_t xTaskGetHandle( const char * pcNameToQuery ) /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+    {
+        UBaseType_t uxQueue = configMAX_PRIORITIES;
+        TCB_t * pxTCB;
+
+        /* Task names will be truncated to configMAX_TASK_NAME_LEN - 1 bytes. */
+        configASSERT( strlen( pcNameToQuery ) < configMAX_TASK_NAME_LEN );
+
+        vTaskSuspendAll();
+        {
+            /* Search the ready lists. */
+            do
+            {
+                uxQueue--;
+                pxTCB = prvSearchForNameWithinSingleList( ( List_t * ) &( pxReadyTasksLists[ uxQueue ] ), pcNameToQuery );
+
+                if( pxTCB != NULL )
+                {
+                    /* Found the handle. */
+                    break;
+                }
+            } while( uxQueue > ( UBaseType_t ) tskIDLE_PRIORITY ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
+
+            /* Search the delayed lists. */
+            if( pxTCB == NULL )
+            {
+                pxTCB = prvSearchForNameWithinSingleList( ( List_t * ) pxDelayedTaskList, pcNameToQuery );
+            }
+
+            if( pxTCB == NULL )
+            {
+                pxTCB = prvSearchForNameWithinSingleList( ( List_t * ) pxOverflowDelayedTaskList, pcNameToQuery );
+            }
+
+            #if ( INCLUDE_vTaskSuspend == 1 )
+                {
+                    if( pxTCB == NULL )
+                    {
+                        /* Search the suspended list. */
+                        pxTCB = prvSearchForNameWithinSingleList( &xSuspendedTaskList, pcNameToQuery );
+                    }
+                }
+            #endif
+
+            #if ( INCLUDE_vTaskDelete == 1 )
+                {
+                    if( pxTCB == NULL )
+                    {
+                        /* Search the deleted list. */
+                        pxTCB = prvSearchForNameWithinSingleList( &xTasksWaitingTermination, pcNameToQuery );
+                    }
+                }
+            #endif
+        }
+        ( void ) xTaskResumeAll();
+
+        return pxTCB;
+    }
+
+#endif /* INCLUDE_xTaskGetHandle */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_TRACE_FACILITY == 1 )
+
+    UBaseType_t uxTaskGetSystemState( TaskStatus_t * const pxTaskStatusArray,
+                                      const UBaseType_t uxArraySize,
+                                      configRUN_TIME_COUNTER_TYPE * const pulTotalRunTime )
+    {
+        UBaseType_t uxTask = 0, uxQueue = configMAX_PRIORITIES;
+
+        vTaskSuspendAll();
+        {
+            /* Is there a space in the array for each task in the system? */
+            if( uxArraySize >= uxCurrentNumberOfTasks )
+            {
+                /* Fill in an TaskStatus_t structure with information on each
+                 * task in the Ready state. */
+                do
+                {
+                    uxQueue--;
+                    uxTask += prvListTasksWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), &( pxReadyTasksLists[ uxQueue ] ), eReady );
+                } while( uxQueue > ( UBaseType_t ) tskIDLE_PRIORITY ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
+
+                /* E.C. : under EDF the ready tasks are held in the deadline
+                 * ordered list instead. */
+                #if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_BAND == 0 ) )
+                    {
+                        uxTask += prvListTasksWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), &xReadyTasksListEDF, eReady );
+                    }
+                #endif
+
+                /* Fill in an TaskStatus_t structure with information on each
+                 * task in the Blocked state. */
+                uxTask += prvListTasksWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), ( List_t * ) pxDelayedTaskList, eBlocked );
+                uxTask += prvListTasksWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), ( List_t * ) pxOverflowDelayedTaskList, eBlocked );
+
+                #if ( INCLUDE_vTaskDelete == 1 )
+                    {
+                        /* Fill in an TaskStatus_t structure with information on
+                         * each task that has been deleted but not yet cleaned up. */
+                        uxTask += prvListTasksWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), &xTasksWaitingTermination, eDeleted );
+                    }
+                #endif
+
+                #if ( INCLUDE_vTaskSuspend == 1 )
+                    {
+                        /* Fill in an TaskStatus_t structure with information on
+                         * each task in the Suspended state. */
+                        uxTask += prvListTasksWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), &xSuspendedTaskList, eSuspended );
+                    }
+                #endif
+
+                #if ( configGENERATE_RUN_TIME_STATS == 1 )
+                    {
+                        if( pulTotalRunTime != NULL )
+                        {
+                            #ifdef portALT_GET_RUN_TIME_COUNTER_VALUE
+                                portALT_GET_RUN_TIME_COUNTER_VALUE( ( *pulTotalRunTime ) );
+                            #else
+                                *pulTotalRunTime = portGET_RUN_TIME_COUNTER_VALUE();
+                            #endif
+                        }
+                    }
+                #else /* if ( configGENERATE_RUN_TIME_STATS == 1 ) */
+                    {
+                        if( pulTotalRunTime != NULL )
+                        {
+                            *pulTotalRunTime = 0;
+                        }
+                    }
+                #endif /* if ( configGENERATE_RUN_TIME_STATS == 1 ) */
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        ( void ) xTaskResumeAll();
+
+        return uxTask;
+    }
+
+#endif /* configUSE_TRACE_FACILITY */
+/*----------------------------------------------------------*/
+
+#if ( ( configUSE_EDF_SCHEDULER == 1 ) || ( configUSE_TRACE_FACILITY == 1 ) )
+
+    static void prvEDFGetInfo( const TCB_t * const pxTCB,
+                               EDFTaskStatus_t * pxEDFStatus )
+    {
+        pxEDFStatus->xHandle = ( TaskHandle_t ) pxTCB;
+
+        #if ( configUSE_EDF_SCHEDULER == 1 )
+            {
+                pxEDFStatus->xPeriod = pxTCB->xTaskPeriod;
+                pxEDFStatus->xRelativeDeadline = pxTCB->xTaskRelativeDeadline;
+                pxEDFStatus->xAbsoluteDeadline = pxTCB->xTaskDeadline;
+                pxEDFStatus->xBudget = pxTCB->xTaskBudget;
+                pxEDFStatus->ulDeadlineMisses = pxTCB->ulDeadlineMisses;
+            }
+        #else
+            {
+                pxEDFStatus->xPeriod = ( TickType_t ) 0U;
+                pxEDFStatus->xRelativeDeadline = ( TickType_t ) 0U;
+                pxEDFStatus->xAbsoluteDeadline = ( TickType_t ) 0U;
+                pxEDFStatus->xBudget = ( TickType_t ) 0U;
+                pxEDFStatus->ulDeadlineMisses = 0UL;
+            }
+        #endif
+
+        #if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_UTILIZATION == 1 ) )
+            {
+                pxEDFStatus->ullRunTime = pxTCB->ullRunTime;
+                pxEDFStatus->ulUtilization = prvEDFPermille( prvEDFLastWindowRunTime( pxTCB ), ulEDFLastWindowLength );
+            }
+        #else
+            {
+                pxEDFStatus->ullRunTime = 0ULL;
+                pxEDFStatus->ulUtilization = 0UL;
+            }
+        #endif
+
+        #if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_OVERLOAD == 1 ) )
+            {
+                pxEDFStatus->uxValue = pxTCB->uxTaskValue;
+                pxEDFStatus->ulJobsShed = pxTCB->ulJobsShed;
+            }
+        #else
+            {
+                pxEDFStatus->uxValue = ( UBaseType_t ) 0U;
+                pxEDFStatus->ulJobsShed = 0UL;
+            }
+        #endif
+    }
+
+#endif /* ( configUSE_EDF_SCHEDULER == 1 ) || ( configUSE_TRACE_FACILITY == 1 ) */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_EDF_SCHEDULER == 1 )
+
+    void vTaskGetEDFInfo( TaskHandle_t xTask,
+                          EDFTaskStatus_t * pxEDFStatus )
+    {
+        configASSERT( pxEDFStatus );
+
+        taskENTER_CRITICAL();
+        {
+            prvEDFGetInfo( prvGetTCBFromHandle( xTask ), pxEDFStatus );
+        }
+        taskEXIT_CRITICAL();
+    }
+/*-----------------------------------------------------------*/
+
+    void vTaskSetEDFParameters( TaskHandle_t xTask,
+                                TickType_t xRelativeDeadline,
+                                TickType_t xBudget )
+    {
+        TCB_t * pxTCB;
+
+        configASSERT( xRelativeDeadline > ( TickType_t ) 0U );
+
+        taskENTER_CRITICAL();
+        {
+            pxTCB = prvGetTCBFromHandle( xTask );
+
+            /* Only constrained deadlines are supported. */
+            configASSERT( xRelativeDeadline <= pxTCB->xTaskPeriod );
+
+            pxTCB->xTaskRelativeDeadline = xRelativeDeadline;
+            pxTCB->xTaskBudget = xBudget;
+        }
+        taskEXIT_CRITICAL();
+    }
 /*-----------------------------------------------------------*/
 
-void vTaskEndScheduler( void )
-{
-    /* Stop the scheduler interrupts and call the portable scheduler end
-     * routine so the original ISRs can be restored if necessary.  The port
-     * layer must ensure interrupts enable  bit is left in the correct state. */
-    portDISABLE_INTERRUPTS();
-    xSchedulerRunning = pdFALSE;
-    vPortEndScheduler();
-}
-/*----------------------------------------------------------*/
-
-void vTaskSuspendAll( void )
-{
-    /* A critical section is not required as the variable is of type
-     * BaseType_t.  Please read Richard Barry's reply in the following link to a
-     * post in the FreeRTOS support forum before reporting this as a bug! -
-     * https://goo.gl/wu4acr */
+    #if ( configUSE_EDF_OVERLOAD == 1 )
 
-    /* portSOFTWARE_BARRIER() is only implemented for emulated/simulated ports that
-     * do not otherwise exhibit real time behaviour. */
-    portSOFTWARE_BARRIER();
+        void vTaskSetEDFValue( TaskHandle_t xTask,
+                               UBaseType_t uxValue )
+        {
+            taskENTER_CRITICAL();
+            {
+                prvGetTCBFromHandle( xTask )->uxTaskValue = uxValue;
+            }
+            taskEXIT_CRITICAL();
+        }
 
-    /* The scheduler is suspended if uxSchedulerSuspended is non-zero.  An increment
-     * is used to allow calls to vTaskSuspendAll() to nest. */
-    ++uxSchedulerSuspended;
+    #endif /* configUSE_EDF_OVERLOAD */
+/*-----------------------------------------------------------*/
 
-    /* Enforces ordering for ports and optimised compilers that may otherwise place
-     * the above increment elsewhere. */
-    portMEMORY_BARRIER();
-}
-/*----------------------------------------------------------*/
+    #if ( configUSE_EDF_FIRM == 1 )
 
-#if ( configUSE_TICKLESS_IDLE != 0 )
+        void vTaskSetEDFFirm( TaskHandle_t xTask,
+                              UBaseType_t uxMaxSkipped,
+                              UBaseType_t uxWindow )
+        {
+            TCB_t * pxTCB;
 
-    static TickType_t prvGetExpectedIdleTime( void )
-    {
-        TickType_t xReturn;
-        UBaseType_t uxHigherPriorityReadyTasks = pdFALSE;
+            /* The history is one 32 bit word. */
+            configASSERT( uxWindow <= ( UBaseType_t ) 32U );
+            configASSERT( ( uxWindow == ( UBaseType_t ) 0U ) ? ( uxMaxSkipped == ( UBaseType_t ) 0U ) : ( uxMaxSkipped < uxWindow ) );
 
-        /* uxHigherPriorityReadyTasks takes care of the case where
-         * configUSE_PREEMPTION is 0, so there may be tasks above the idle priority
-         * task that are in the Ready state, even though the idle task is
-         * running. */
-        #if ( configUSE_PORT_OPTIMISED_TASK_SELECTION == 0 )
+            taskENTER_CRITICAL();
             {
-                if( uxTopReadyPriority > tskIDLE_PRIORITY )
-                {
-                    uxHigherPriorityReadyTasks = pdTRUE;
-                }
+                pxTCB = prvGetTCBFromHandle( xTask );
+                pxTCB->uxFirmMaxSkipped = uxMaxSkipped;
+                pxTCB->uxFirmWindow = uxWindow;
+                pxTCB->uxFirmSkipped = ( UBaseType_t ) 0U;
+                pxTCB->ulFirmHistory = 0UL;
             }
-        #else
+            taskEXIT_CRITICAL();
+        }
+
+    #endif /* configUSE_EDF_FIRM */
+/*-----------------------------------------------------------*/
+
+    #if ( configUSE_EDF_MIXED_CRITICALITY == 1 )
+
+        void vTaskSetEDFCriticality( TaskHandle_t xTask,
+                                     TickType_t xBudgetHigh,
+                                     TickType_t xVirtualDeadline )
+        {
+            TCB_t * pxTCB;
+
+            taskENTER_CRITICAL();
             {
-                const UBaseType_t uxLeastSignificantBit = ( UBaseType_t ) 0x01;
+                pxTCB = prvGetTCBFromHandle( xTask );
 
-                /* When port optimised task selection is used the uxTopReadyPriority
-                 * variable is used as a bit map.  If bits other than the least
-                 * significant bit are set then there are tasks that have a priority
-                 * above the idle priority that are in the Ready state.  This takes
-                 * care of the case where the co-operative scheduler is in use. */
-                if( uxTopReadyPriority > uxLeastSignificantBit )
+                if( xBudgetHigh != ( TickType_t ) 0U )
                 {
-                    uxHigherPriorityReadyTasks = pdTRUE;
+                    configASSERT( xBudgetHigh >= pxTCB->xTaskBudget );
+                    configASSERT( ( xVirtualDeadline > ( TickType_t ) 0U ) && ( xVirtualDeadline <= pxTCB->xTaskRelativeDeadline ) );
                 }
-            }
-        #endif /* if ( configUSE_PORT_OPTIMISED_TASK_SELECTION == 0 ) */
 
-        if( pxCurrentTCB->uxPriority > tskIDLE_PRIORITY )
-        {
-            xReturn = 0;
+                pxTCB->xTaskBudgetHigh = xBudgetHigh;
+                pxTCB->xTaskVirtualDeadline = xVirtualDeadline;
+            }
+            taskEXIT_CRITICAL();
         }
-        else if( listCURRENT_LIST_LENGTH( &( pxReadyTasksLists[ tskIDLE_PRIORITY ] ) ) > 1 )
+/*-----------------------------------------------------------*/
+
+        BaseType_t xTaskGetEDFCriticalityMode( void )
         {
-            /* There are other idle priority tasks in the ready state.  If
-             * time slicing is used then the very next tick interrupt must be
-             * processed. */
-            xReturn = 0;
+            return xEDFCriticalityMode;
         }
-        else if( uxHigherPriorityReadyTasks != pdFALSE )
+
+    #endif /* configUSE_EDF_MIXED_CRITICALITY */
+/*-----------------------------------------------------------*/
+
+    #if ( configUSE_EDF_ELASTIC == 1 )
+
+        static uint32_t prvEDFElasticShare( TickType_t xBudget,
+                                            TickType_t xPeriod )
         {
-            /* There are tasks in the Ready state that have a priority above the
-             * idle priority.  This path can only be reached if
-             * configUSE_PREEMPTION is 0. */
-            xReturn = 0;
+            return ( uint32_t ) ( ( ( uint64_t ) xBudget * 1000000ULL + ( uint64_t ) xPeriod - 1ULL ) / ( uint64_t ) xPeriod );
         }
-        else
+/*-----------------------------------------------------------*/
+
+        void vTaskSetEDFElastic( TaskHandle_t xTask,
+                                 TickType_t xPeriodMax,
+                                 UBaseType_t uxElasticity )
         {
-            xReturn = xNextTaskUnblockTime - xTickCount;
-        }
+            TCB_t * pxTCB;
 
-        return xReturn;
-    }
+            taskENTER_CRITICAL();
+            {
+                pxTCB = prvGetTCBFromHandle( xTask );
 
-#endif /* configUSE_TICKLESS_IDLE */
-/*----------------------------------------------------------*/
+                /* Only periodic tasks have a period to stretch. */
+                configASSERT( pxTCB->xTaskPeriod > ( TickType_t ) 0U );
 
-BaseType_t xTaskResumeAll( void )
-{
-    TCB_t * pxTCB = NULL;
-    BaseType_t xAlreadyYielded = pdFALSE;
+                if( pxTCB->xTaskPeriodMax == ( TickType_t ) 0U )
+                {
+                    pxTCB->xTaskPeriodMin = pxTCB->xTaskPeriod;
+                    pxTCB->xTaskPeriodNext = pxTCB->xTaskPeriod;
+                    pxTCB->pxNextElastic = pxEDFElasticTasks;
+                    pxEDFElasticTasks = pxTCB;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
 
-    /* If uxSchedulerSuspended is zero then this function does not match a
-     * previous call to vTaskSuspendAll(). */
-    configASSERT( uxSchedulerSuspended );
+                configASSERT( xPeriodMax >= pxTCB->xTaskPeriodMin );
 
-    /* It is possible that an ISR caused a task to be removed from an event
-     * list while the scheduler was suspended.  If this was the case then the
-     * removed task will have been added to the xPendingReadyList.  Once the
-     * scheduler has been resumed it is safe to move all the pending ready
-     * tasks from this list into their appropriate ready list. */
-    taskENTER_CRITICAL();
-    {
-        --uxSchedulerSuspended;
+                pxTCB->xTaskPeriodMax = xPeriodMax;
+                pxTCB->uxElasticity = uxElasticity;
+            }
+            taskEXIT_CRITICAL();
+        }
+/*-----------------------------------------------------------*/
 
-        if( uxSchedulerSuspended == ( UBaseType_t ) pdFALSE )
+        BaseType_t xTaskEDFElasticAdapt( uint32_t ulTargetUtilization )
         {
-            if( uxCurrentNumberOfTasks > ( UBaseType_t ) 0U )
+            TCB_t * pxTCB;
+            uint32_t ulFixed, ulNominal, ulExcess, ulShare, ulCut;
+            UBaseType_t uxElasticity;
+            BaseType_t xSaturated;
+            uint64_t ullPeriod;
+
+            /* The tick does not touch the periods and xTaskDelayUntil() reads
+             * them with the scheduler suspended, so suspending it is enough. */
+            vTaskSuspendAll();
             {
-                /* Move any readied tasks from the pending list into the
-                 * appropriate ready list. */
-                while( listLIST_IS_EMPTY( &xPendingReadyList ) == pdFALSE )
+                for( pxTCB = pxEDFElasticTasks; pxTCB != NULL; pxTCB = pxTCB->pxNextElastic )
                 {
-                    pxTCB = listGET_OWNER_OF_HEAD_ENTRY( ( &xPendingReadyList ) ); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
-                    listREMOVE_ITEM( &( pxTCB->xEventListItem ) );
-                    portMEMORY_BARRIER();
-                    listREMOVE_ITEM( &( pxTCB->xStateListItem ) );
-                    prvAddTaskToReadyList( pxTCB );
+                    pxTCB->xTaskPeriodNext = pxTCB->xTaskPeriodMin;
+                }
 
-                    /* If the moved task has a priority higher than or equal to
-                     * the current task then a yield must be performed. */
-                    if( pxTCB->uxPriority >= pxCurrentTCB->uxPriority )
+                /* Each pass shares the excess among the tasks that can still
+                 * stretch, in proportion to their elasticity.  A task that
+                 * reaches its longest period keeps it and the excess is shared
+                 * again among the others, so there are at most as many passes
+                 * as tasks. */
+                do
+                {
+                    ulFixed = 0UL;
+                    ulNominal = 0UL;
+                    uxElasticity = ( UBaseType_t ) 0U;
+                    xSaturated = pdFALSE;
+
+                    for( pxTCB = pxEDFElasticTasks; pxTCB != NULL; pxTCB = pxTCB->pxNextElastic )
                     {
-                        xYieldPending = pdTRUE;
+                        if( taskEDF_CAN_STRETCH( pxTCB ) )
+                        {
+                            ulNominal += prvEDFElasticShare( pxTCB->xTaskBudget, pxTCB->xTaskPeriodMin );
+                            uxElasticity += pxTCB->uxElasticity;
+                        }
+                        else
+                        {
+                            ulFixed += prvEDFElasticShare( pxTCB->xTaskBudget, pxTCB->xTaskPeriodNext );
+                        }
                     }
-                    else
+
+                    if( ( uxElasticity == ( UBaseType_t ) 0U ) || ( ( ulFixed + ulNominal ) <= ulTargetUtilization ) )
                     {
-                        mtCOVERAGE_TEST_MARKER();
+                        break;
                     }
-                }
-
-                if( pxTCB != NULL )
-                {
-                    /* A task was unblocked while the scheduler was suspended,
-                     * which may have prevented the next unblock time from being
-                     * re-calculated, in which case re-calculate it now.  Mainly
-                     * important for low power tickless implementations, where
-                     * this can prevent an unnecessary exit from low power
-                     * state. */
-                    prvResetNextTaskUnblockTime();
-                }
 
-                /* If any ticks occurred while the scheduler was suspended then
-                 * they should be processed now.  This ensures the tick count does
-                 * not  slip, and that any delayed tasks are resumed at the correct
-                 * time. */
-                {
-                    TickType_t xPendedCounts = xPendedTicks; /* Non-volatile copy. */
+                    ulExcess = ( ulFixed + ulNominal ) - ulTargetUtilization;
 
-                    if( xPendedCounts > ( TickType_t ) 0U )
+                    for( pxTCB = pxEDFElasticTasks; pxTCB != NULL; pxTCB = pxTCB->pxNextElastic )
                     {
-                        do
+                        if( taskEDF_CAN_STRETCH( pxTCB ) )
                         {
-                            if( xTaskIncrementTick() != pdFALSE )
+                            ulShare = prvEDFElasticShare( pxTCB->xTaskBudget, pxTCB->xTaskPeriodMin );
+                            ulCut = ( uint32_t ) ( ( ( uint64_t ) ulExcess * ( uint64_t ) pxTCB->uxElasticity + ( uint64_t ) uxElasticity - 1ULL ) / ( uint64_t ) uxElasticity );
+
+                            /* The period is rounded up, which can only lower the
+                             * share below what the task was given. */
+                            if( ulCut < ulShare )
                             {
-                                xYieldPending = pdTRUE;
+                                ullPeriod = ( ( uint64_t ) pxTCB->xTaskBudget * 1000000ULL + ( uint64_t ) ( ulShare - ulCut ) - 1ULL ) / ( uint64_t ) ( ulShare - ulCut );
                             }
                             else
                             {
-                                mtCOVERAGE_TEST_MARKER();
+                                ullPeriod = ( uint64_t ) pxTCB->xTaskPeriodMax;
                             }
 
-                            --xPendedCounts;
-                        } while( xPendedCounts > ( TickType_t ) 0U );
+                            if( ullPeriod >= ( uint64_t ) pxTCB->xTaskPeriodMax )
+                            {
+                                pxTCB->xTaskPeriodNext = pxTCB->xTaskPeriodMax;
+                                xSaturated = pdTRUE;
+                            }
+                            else
+                            {
+                                pxTCB->xTaskPeriodNext = ( TickType_t ) ullPeriod;
+                            }
+                        }
+                        else
+                        {
+                            mtCOVERAGE_TEST_MARKER();
+                        }
+                    }
+                } while( xSaturated != pdFALSE );
 
-                        xPendedTicks = 0;
+                ulShare = 0UL;
+
+                for( pxTCB = pxEDFElasticTasks; pxTCB != NULL; pxTCB = pxTCB->pxNextElastic )
+                {
+                    ulShare += prvEDFElasticShare( pxTCB->xTaskBudget, pxTCB->xTaskPeriodNext );
+                }
+            }
+            ( void ) xTaskResumeAll();
+
+            return ( ulShare <= ulTargetUtilization ) ? pdPASS : pdFAIL;
+        }
+
+    #endif /* configUSE_EDF_ELASTIC */
+/*-----------------------------------------------------------*/
+
+    #if ( configUSE_EDF_MODES == 1 )
+
+        static void prvEDFApplyModeChange( const EDFModeChange_t * const pxChange )
+        {
+            UBaseType_t ux;
+            TCB_t * pxTCB;
+
+            traceEDF_MODE_CHANGE( pxChange );
+
+            /* Only the tasks that change are touched.  A NULL handle would
+             * stop the calling task, the idle task. */
+            for( ux = ( UBaseType_t ) 0U; ux < pxChange->uxStop; ux++ )
+            {
+                configASSERT( pxChange->pxStop[ ux ] );
+                vTaskSuspend( pxChange->pxStop[ ux ] );
+            }
+
+            for( ux = ( UBaseType_t ) 0U; ux < pxChange->uxStart; ux++ )
+            {
+                pxTCB = pxChange->pxStart[ ux ];
+                configASSERT( pxTCB );
+
+                taskENTER_CRITICAL();
+                {
+                    if( prvTaskIsTaskSuspended( pxTCB ) != pdFALSE )
+                    {
+                        /* The task is released now.  Left alone the wake time
+                         * of a periodic task would be as old as the mode it
+                         * was stopped in, and it would catch up on every
+                         * period it missed. */
+                        ( void ) uxListRemove( &( pxTCB->xStateListItem ) );
+
+                        if( pxTCB->pxTaskLastWakeTime != NULL )
+                        {
+                            *( pxTCB->pxTaskLastWakeTime ) = xTickCount;
+                        }
+                        else
+                        {
+                            mtCOVERAGE_TEST_MARKER();
+                        }
+
+                        taskEDF_SET_DEADLINE( pxTCB, xTickCount );
+                        prvAddTaskToReadyList( pxTCB );
+                        taskEDF_RECORD_JOB_RELEASE( pxTCB );
                     }
                     else
                     {
                         mtCOVERAGE_TEST_MARKER();
                     }
                 }
+                taskEXIT_CRITICAL();
+            }
+        }
+/*-----------------------------------------------------------*/
 
-                if( xYieldPending != pdFALSE )
-                {
-                    #if ( configUSE_PREEMPTION != 0 )
-                        {
-                            xAlreadyYielded = pdTRUE;
-                        }
-                    #endif
-                    taskYIELD_IF_USING_PREEMPTION();
-                }
-                else
+        BaseType_t xTaskEDFModeChange( const EDFModeChange_t * pxChange )
+        {
+            BaseType_t xReturn = pdFAIL;
+
+            configASSERT( pxChange );
+
+            if( xSchedulerRunning == pdFALSE )
+            {
+                prvEDFApplyModeChange( pxChange );
+                xReturn = pdPASS;
+            }
+            else
+            {
+                taskENTER_CRITICAL();
                 {
-                    mtCOVERAGE_TEST_MARKER();
+                    if( pxEDFModeChange == NULL )
+                    {
+                        pxEDFModeChange = pxChange;
+                        xReturn = pdPASS;
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
                 }
+                taskEXIT_CRITICAL();
             }
+
+            return xReturn;
         }
-        else
+/*-----------------------------------------------------------*/
+
+        BaseType_t xTaskEDFModeChangePending( void )
         {
-            mtCOVERAGE_TEST_MARKER();
+            return ( pxEDFModeChange != NULL ) ? pdTRUE : pdFALSE;
         }
-    }
-    taskEXIT_CRITICAL();
 
-    return xAlreadyYielded;
-}
+    #endif /* configUSE_EDF_MODES */
 /*-----------------------------------------------------------*/
 
-TickType_t xTaskGetTickCount( void )
-{
-    TickType_t xTicks;
+    #if ( configUSE_EDF_LIMITED_PREEMPTION == 1 )
 
-    /* Critical section required if running on a 16 bit processor. */
-    portTICK_TYPE_ENTER_CRITICAL();
-    {
-        xTicks = xTickCount;
-    }
-    portTICK_TYPE_EXIT_CRITICAL();
+        static BaseType_t prvEDFDeferPreemption( void )
+        {
+            BaseType_t xDeferred = pdFALSE;
+            UBaseType_t uxTopPriority = pxCurrentTCB->uxPriority;
 
-    return xTicks;
-}
+            /* E.C. : a region only holds back the jobs of its own band.  The
+             * running task was the highest ready priority when it was picked,
+             * so a higher one now is a task readied above the band, which
+             * preempts at once. */
+            #if ( configUSE_EDF_BAND == 1 )
+                {
+                    #if ( configUSE_PORT_OPTIMISED_TASK_SELECTION == 0 )
+                        uxTopPriority = uxTopReadyPriority;
+                    #else
+                        portGET_HIGHEST_PRIORITY( uxTopPriority, uxTopReadyPriority );
+                    #endif
+                }
+            #endif
+
+            if( taskEDF_IN_NON_PREEMPTIVE_REGION() && ( uxTopPriority <= pxCurrentTCB->uxPriority ) )
+            {
+                xEDFPreemptionDeferred = pdTRUE;
+                xDeferred = pdTRUE;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            return xDeferred;
+        }
 /*-----------------------------------------------------------*/
 
-TickType_t xTaskGetTickCountFromISR( void )
-{
-    TickType_t xReturn;
-    UBaseType_t uxSavedInterruptStatus;
+        void vTaskSetEDFNonPreemptive( TaskHandle_t xTask,
+                                       TickType_t xRegion )
+        {
+            taskENTER_CRITICAL();
+            {
+                prvGetTCBFromHandle( xTask )->xTaskNonPreemptive = xRegion;
+            }
+            taskEXIT_CRITICAL();
+        }
+/*-----------------------------------------------------------*/
 
-    /* RTOS ports that support interrupt nesting have the concept of a maximum
-     * system call (or maximum API call) interrupt priority.  Interrupts that are
-     * above the maximum system call priority are kept permanently enabled, even
-     * when the RTOS kernel is in a critical section, but cannot make any calls to
-     * FreeRTOS API functions.  If configASSERT() is defined in FreeRTOSConfig.h
-     * then portASSERT_IF_INTERRUPT_PRIORITY_INVALID() will result in an assertion
-     * failure if a FreeRTOS API function is called from an interrupt that has been
-     * assigned a priority above the configured maximum system call priority.
-     * Only FreeRTOS functions that end in FromISR can be called from interrupts
-     * that have been assigned a priority at or (logically) below the maximum
-     * system call  interrupt priority.  FreeRTOS maintains a separate interrupt
-     * safe API to ensure interrupt entry is as fast and as simple as possible.
-     * More information (albeit Cortex-M specific) is provided on the following
-     * link: https://www.FreeRTOS.org/RTOS-Cortex-M3-M4.html */
-    portASSERT_IF_INTERRUPT_PRIORITY_INVALID();
+        void vTaskEDFPreemptionPoint( void )
+        {
+            BaseType_t xDeferred;
 
-    uxSavedInterruptStatus = portTICK_TYPE_SET_INTERRUPT_MASK_FROM_ISR();
-    {
-        xReturn = xTickCount;
-    }
-    portTICK_TYPE_CLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+            taskENTER_CRITICAL();
+            {
+                xDeferred = xEDFPreemptionDeferred;
+                xEDFRegionExecuted = ( TickType_t ) 0U;
+            }
+            taskEXIT_CRITICAL();
 
-    return xReturn;
-}
-/*-----------------------------------------------------------*/
+            if( xDeferred != pdFALSE )
+            {
+                taskYIELD();
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
 
-UBaseType_t uxTaskGetNumberOfTasks( void )
-{
-    /* A critical section is not required because the variables are of type
-     * BaseType_t. */
-    return uxCurrentNumberOfTasks;
-}
+    #endif /* configUSE_EDF_LIMITED_PREEMPTION */
 /*-----------------------------------------------------------*/
 
-char * pcTaskGetName( TaskHandle_t xTaskToQuery ) /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
-{
-    TCB_t * pxTCB;
+    #if ( configUSE_EDF_PREEMPTION_THRESHOLD == 1 )
 
-    /* If null is passed in here then the name of the calling task is being
-     * queried. */
-    pxTCB = prvGetTCBFromHandle( xTaskToQuery );
-    configASSERT( pxTCB );
-    return &( pxTCB->pcTaskName[ 0 ] );
-}
-/*-----------------------------------------------------------*/
+        void vTaskSetEDFThreshold( TaskHandle_t xTask,
+                                   TickType_t xThreshold )
+        {
+            TCB_t * pxTCB;
 
-#if ( INCLUDE_xTaskGetHandle == 1 )
+            taskENTER_CRITICAL();
+            {
+                pxTCB = prvGetTCBFromHandle( xTask );
 
-    static TCB_t * prvSearchForNameWithinSingleList( List_t * pxList,
-                                                     const char pcNameToQuery[] )
-    {
-        TCB_t * pxNextTCB, * pxFirstTCB, * pxReturn = NULL;
-        UBaseType_t x;
-        char cNextChar;
-        BaseType_t xBreakLoop;
+                /* Above the relative deadline a threshold has no effect, a
+                 * job released later with an earlier deadline always has a
+                 * shorter relative deadline. */
+                configASSERT( xThreshold <= pxTCB->xTaskRelativeDeadline );
 
-        /* This function is called with the scheduler suspended. */
+                pxTCB->xTaskThreshold = xThreshold;
+            }
+            taskEXIT_CRITICAL();
+        }
+/*-----------------------------------------------------------*/
 
-        if( listCURRENT_LIST_LENGTH( pxList ) > ( UBaseType_t ) 0 )
+        static TCB_t * prvEDFSelectAboveCeiling( void )
         {
-            listGET_OWNER_OF_NEXT_ENTRY( pxFirstTCB, pxList ); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
+            const ListItem_t * pxEnd = listGET_END_MARKER( &xReadyTasksListEDF );
+            ListItem_t * pxItem;
+            TCB_t * pxTCB;
 
-            do
+            /* The started jobs are few, and their thresholds only matter
+             * while they are ready, so the ceiling is worked out here rather
+             * than kept up to date as jobs block and are readied. */
+            xEDFSystemCeiling = ( TickType_t ) 0U;
+
+            for( pxItem = listGET_HEAD_ENTRY( &xReadyTasksListEDF ); pxItem != pxEnd; pxItem = listGET_NEXT( pxItem ) )
             {
-                listGET_OWNER_OF_NEXT_ENTRY( pxNextTCB, pxList ); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
+                pxTCB = listGET_LIST_ITEM_OWNER( pxItem );
 
-                /* Check each character in the name looking for a match or
-                 * mismatch. */
-                xBreakLoop = pdFALSE;
+                if( ( pxTCB->xThresholdHeld != pdFALSE ) &&
+                    ( ( xEDFSystemCeiling == ( TickType_t ) 0U ) || ( pxTCB->xTaskThreshold < xEDFSystemCeiling ) ) )
+                {
+                    xEDFSystemCeiling = pxTCB->xTaskThreshold;
+                }
+            }
 
-                for( x = ( UBaseType_t ) 0; x < ( UBaseType_t ) configMAX_TASK_NAME_LEN; x++ )
+            /* A started job is always found, so the head is only taken when
+             * there is no ceiling. */
+            pxTCB = listGET_OWNER_OF_HEAD_ENTRY( &xReadyTasksListEDF );
+
+            if( xEDFSystemCeiling != ( TickType_t ) 0U )
+            {
+                for( pxItem = listGET_HEAD_ENTRY( &xReadyTasksListEDF ); pxItem != pxEnd; pxItem = listGET_NEXT( pxItem ) )
                 {
-                    cNextChar = pxNextTCB->pcTaskName[ x ];
+                    pxTCB = listGET_LIST_ITEM_OWNER( pxItem );
 
-                    if( cNextChar != pcNameToQuery[ x ] )
+                    if( ( pxTCB->xThresholdHeld != pdFALSE ) || ( pxTCB->xTaskRelativeDeadline < xEDFSystemCeiling ) )
                     {
-                        /* Characters didn't match. */
-                        xBreakLoop = pdTRUE;
+                        break;
                     }
-                    else if( cNextChar == ( char ) 0x00 )
+                }
+            }
+
+            return pxTCB;
+        }
+
+    #endif /* configUSE_EDF_PREEMPTION_THRESHOLD */
+/*-----------------------------------------------------------*/
+
+    #if ( configUSE_EDF_SLACK_STEALING == 1 )
+
+        void vTaskSetEDFSoft( TaskHandle_t xTask )
+        {
+            taskENTER_CRITICAL();
+            {
+                prvGetTCBFromHandle( xTask )->ucSoft = pdTRUE;
+                taskEDF_SLACK_STALE();
+            }
+            taskEXIT_CRITICAL();
+        }
+
+    #endif /* configUSE_EDF_SLACK_STEALING */
+/*-----------------------------------------------------------*/
+
+    #if ( configUSE_EDF_TBS == 1 )
+
+        void vTaskSetEDFServer( TaskHandle_t xTask,
+                                uint32_t ulBandwidth )
+        {
+            TCB_t * pxTCB;
+
+            configASSERT( ulBandwidth <= 1000000UL );
+
+            taskENTER_CRITICAL();
+            {
+                pxTCB = prvGetTCBFromHandle( xTask );
+
+                /* The span is worked out once here so a release only has to
+                 * add it.  Rounded up, and never 0, which is not a server. */
+                if( ulBandwidth != 0UL )
+                {
+                    configASSERT( pxTCB->xTaskBudget > ( TickType_t ) 0U );
+                    pxTCB->xServerSpan = ( TickType_t ) ( ( ( uint64_t ) pxTCB->xTaskBudget * 1000000ULL + ( uint64_t ) ulBandwidth - 1ULL ) / ( uint64_t ) ulBandwidth );
+
+                    if( pxTCB->xServerSpan == ( TickType_t ) 0U )
                     {
-                        /* Both strings terminated, a match must have been
-                         * found. */
-                        pxReturn = pxNextTCB;
-                        xBreakLoop = pdTRUE;
+                        pxTCB->xServerSpan = ( TickType_t ) 1U;
                     }
                     else
                     {
                         mtCOVERAGE_TEST_MARKER();
                     }
-
-                    if( xBreakLoop != pdFALSE )
-                    {
-                        break;
-                    }
                 }
-
-                if( pxReturn != NULL )
+                else
                 {
-                    /* The handle has been found. */
-                    break;
+                    pxTCB->xServerSpan = ( TickType_t ) 0U;
                 }
-            } while( pxNextTCB != pxFirstTCB );
+            }
+            taskEXIT_CRITICAL();
         }
-        else
+
+    #endif /* configUSE_EDF_TBS */
+/*-----------------------------------------------------------*/
+
+    #if ( configUSE_EDF_DVS == 1 )
+
+        uint32_t ulTaskGetEDFSpeed( void )
         {
-            mtCOVERAGE_TEST_MARKER();
+            return ulEDFSpeed;
         }
 
-        return pxReturn;
-    }
+    #endif /* configUSE_EDF_DVS */
 
-#endif /* INCLUDE_xTaskGetHandle */
+#endif /* configUSE_EDF_SCHEDULER */
 /*-----------------------------------------------------------*/
 
-#if ( INCLUDE_xTaskGetHandle == 1 )
+#if ( configUSE_TRACE_FACILITY == 1 )
 
-    TaskHandle_t xTaskGetHandle( const char * pcNameToQuery ) /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+    UBaseType_t uxTaskGetSystemStateEDF( TaskStatus_t * const pxTaskStatusArray,
+                                         EDFTaskStatus_t * const pxEDFStatusArray,
+                                         const UBaseType_t uxArraySize,
+                                         uint32_t * const pulCpuLoad )
     {
-        UBaseType_t uxQueue = configMAX_PRIORITIES;
-        TCB_t * pxTCB;
-
-        /* Task names will be truncated to configMAX_TASK_NAME_LEN - 1 bytes. */
-        configASSERT( strlen( pcNameToQuery ) < configMAX_TASK_NAME_LEN );
+        UBaseType_t uxTask, x;
 
         vTaskSuspendAll();
         {
-            /* Search the ready lists. */
-            do
-            {
-                uxQueue--;
-                pxTCB = prvSearchForNameWithinSingleList( ( List_t * ) &( pxReadyTasksLists[ uxQueue ] ), pcNameToQuery );
+            uxTask = uxTaskGetSystemState( pxTaskStatusArray, uxArraySize, NULL );
 
-                if( pxTCB != NULL )
+            /* E.C. : the handles are already in pxTaskStatusArray, so the EDF
+             * entries are filled in without walking the task lists again. */
+            if( pxEDFStatusArray != NULL )
+            {
+                for( x = 0; x < uxTask; x++ )
                 {
-                    /* Found the handle. */
-                    break;
+                    prvEDFGetInfo( pxTaskStatusArray[ x ].xHandle, &( pxEDFStatusArray[ x ] ) );
                 }
-            } while( uxQueue > ( UBaseType_t ) tskIDLE_PRIORITY ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
-
-            /* Search the delayed lists. */
-            if( pxTCB == NULL )
-            {
-                pxTCB = prvSearchForNameWithinSingleList( ( List_t * ) pxDelayedTaskList, pcNameToQuery );
             }
-
-            if( pxTCB == NULL )
+            else
             {
-                pxTCB = prvSearchForNameWithinSingleList( ( List_t * ) pxOverflowDelayedTaskList, pcNameToQuery );
+                mtCOVERAGE_TEST_MARKER();
             }
+        }
+        ( void ) xTaskResumeAll();
 
-            #if ( INCLUDE_vTaskSuspend == 1 )
+        if( pulCpuLoad != NULL )
+        {
+            #if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_UTILIZATION == 1 ) )
                 {
-                    if( pxTCB == NULL )
-                    {
-                        /* Search the suspended list. */
-                        pxTCB = prvSearchForNameWithinSingleList( &xSuspendedTaskList, pcNameToQuery );
-                    }
+                    *pulCpuLoad = ulEDFCpuLoad;
                 }
-            #endif
-
-            #if ( INCLUDE_vTaskDelete == 1 )
+            #else
                 {
-                    if( pxTCB == NULL )
-                    {
-                        /* Search the deleted list. */
-                        pxTCB = prvSearchForNameWithinSingleList( &xTasksWaitingTermination, pcNameToQuery );
-                    }
+                    *pulCpuLoad = 0UL;
                 }
             #endif
         }
-        ( void ) xTaskResumeAll();
 
-        return pxTCB;
+        return uxTask;
+    }
+
+#endif /* configUSE_TRACE_FACILITY */
+/*----------------------------------------------------------*/
+
+#if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_UTILIZATION == 1 ) )
+
+    static void prvEDFAccountRunTime( void )
+    {
+        const uint32_t ulNow = configEDF_TIMESTAMP();
+        TCB_t * const pxTCB = pxCurrentTCB;
+
+        /* First time the task runs in this window, so the run time it
+         * accumulated since it last rolled over all belongs to the previous
+         * window if it ran in that one, and to none of interest otherwise. */
+        if( pxTCB->ulWindowNumber != ulEDFWindowNumber )
+        {
+            if( ( pxTCB->ulWindowNumber + 1UL ) == ulEDFWindowNumber )
+            {
+                pxTCB->ulLastWindowRunTime = ( uint32_t ) ( pxTCB->ullRunTime - pxTCB->ullWindowStartRunTime );
+            }
+            else
+            {
+                pxTCB->ulLastWindowRunTime = 0UL;
+            }
+
+            pxTCB->ullWindowStartRunTime = pxTCB->ullRunTime;
+            pxTCB->ulWindowNumber = ulEDFWindowNumber;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        /* The 32 bit difference is correct across a wrap of the time stamp
+         * clock as long as no single interval is longer than the wrap
+         * period. */
+        pxTCB->ullRunTime += ( uint32_t ) ( ulNow - ulEDFSwitchedInTime );
+        ulEDFSwitchedInTime = ulNow;
     }
-
-#endif /* INCLUDE_xTaskGetHandle */
 /*-----------------------------------------------------------*/
 
-#if ( configUSE_TRACE_FACILITY == 1 )
-
-    UBaseType_t uxTaskGetSystemState( TaskStatus_t * const pxTaskStatusArray,
-                                      const UBaseType_t uxArraySize,
-                                      configRUN_TIME_COUNTER_TYPE * const pulTotalRunTime )
+    static uint32_t prvEDFLastWindowRunTime( const TCB_t * const pxTCB )
     {
-        UBaseType_t uxTask = 0, uxQueue = configMAX_PRIORITIES;
+        uint32_t ulReturn;
 
-        vTaskSuspendAll();
+        if( pxTCB->ulWindowNumber == ulEDFWindowNumber )
         {
-            /* Is there a space in the array for each task in the system? */
-            if( uxArraySize >= uxCurrentNumberOfTasks )
-            {
-                /* Fill in an TaskStatus_t structure with information on each
-                 * task in the Ready state. */
-                do
-                {
-                    uxQueue--;
-                    uxTask += prvListTasksWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), &( pxReadyTasksLists[ uxQueue ] ), eReady );
-                } while( uxQueue > ( UBaseType_t ) tskIDLE_PRIORITY ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
+            ulReturn = pxTCB->ulLastWindowRunTime;
+        }
+        else if( ( pxTCB->ulWindowNumber + 1UL ) == ulEDFWindowNumber )
+        {
+            /* Has not run since the window closed. */
+            ulReturn = ( uint32_t ) ( pxTCB->ullRunTime - pxTCB->ullWindowStartRunTime );
+        }
+        else
+        {
+            ulReturn = 0UL;
+        }
 
-                /* Fill in an TaskStatus_t structure with information on each
-                 * task in the Blocked state. */
-                uxTask += prvListTasksWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), ( List_t * ) pxDelayedTaskList, eBlocked );
-                uxTask += prvListTasksWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), ( List_t * ) pxOverflowDelayedTaskList, eBlocked );
+        return ulReturn;
+    }
+/*-----------------------------------------------------------*/
 
-                #if ( INCLUDE_vTaskDelete == 1 )
-                    {
-                        /* Fill in an TaskStatus_t structure with information on
-                         * each task that has been deleted but not yet cleaned up. */
-                        uxTask += prvListTasksWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), &xTasksWaitingTermination, eDeleted );
-                    }
-                #endif
+    static uint32_t prvEDFPermille( uint32_t ulPart,
+                                    uint32_t ulWhole )
+    {
+        uint32_t ulReturn = 0UL;
 
-                #if ( INCLUDE_vTaskSuspend == 1 )
-                    {
-                        /* Fill in an TaskStatus_t structure with information on
-                         * each task in the Suspended state. */
-                        uxTask += prvListTasksWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), &xSuspendedTaskList, eSuspended );
-                    }
-                #endif
+        /* Keep ulPart * 1000 within 32 bits. */
+        while( ulWhole > 0x003FFFFFUL )
+        {
+            ulPart >>= 1;
+            ulWhole >>= 1;
+        }
 
-                #if ( configGENERATE_RUN_TIME_STATS == 1 )
-                    {
-                        if( pulTotalRunTime != NULL )
-                        {
-                            #ifdef portALT_GET_RUN_TIME_COUNTER_VALUE
-                                portALT_GET_RUN_TIME_COUNTER_VALUE( ( *pulTotalRunTime ) );
-                            #else
-                                *pulTotalRunTime = portGET_RUN_TIME_COUNTER_VALUE();
-                            #endif
-                        }
-                    }
-                #else /* if ( configGENERATE_RUN_TIME_STATS == 1 ) */
-                    {
-                        if( pulTotalRunTime != NULL )
-                        {
-                            *pulTotalRunTime = 0;
-                        }
-                    }
-                #endif /* if ( configGENERATE_RUN_TIME_STATS == 1 ) */
-            }
-            else
-            {
-                mtCOVERAGE_TEST_MARKER();
-            }
+        if( ulWhole != 0UL )
+        {
+            ulReturn = ( ulPart * 1000UL ) / ulWhole;
         }
-        ( void ) xTaskResumeAll();
 
-        return uxTask;
+        return ulReturn;
     }
+/*-----------------------------------------------------------*/
 
-#endif /* configUSE_TRACE_FACILITY */
+    uint32_t ulTaskGetCpuLoad( void )
+    {
+        return ulEDFCpuLoad;
+    }
+
+#endif /* ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_UTILIZATION == 1 ) */
 /*----------------------------------------------------------*/
 
 #if ( INCLUDE_xTaskGetIdleTaskHandle == 1 )
@@ -2911,6 +5525,74 @@ BaseType_t xTaskIncrementTick( void )
             mtCOVERAGE_TEST_MARKER();
         }
 
+        /* E.C. : the running job used this tick of its budget.  A HI job that
+         * runs past its LO budget switches the system to HI mode. */
+        #if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_OVERLOAD == 1 ) )
+            {
+                pxCurrentTCB->xJobExecuted++;
+
+                #if ( configUSE_EDF_MIXED_CRITICALITY == 1 )
+                    {
+                        if( ( xEDFCriticalityMode == edfCRITICALITY_LO ) &&
+                            ( pxCurrentTCB->xTaskBudgetHigh != ( TickType_t ) 0U ) &&
+                            ( pxCurrentTCB->xJobExecuted > pxCurrentTCB->xTaskBudget ) )
+                        {
+                            prvEDFSwitchToHighCriticality();
+                            xSwitchRequired = pdTRUE;
+                        }
+                        else
+                        {
+                            mtCOVERAGE_TEST_MARKER();
+                        }
+                    }
+                #endif
+            }
+        #endif
+
+        /* E.C. : the running job did a tick of work at the current speed. */
+        #if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_DVS == 1 ) )
+            {
+                pxCurrentTCB->ullDVSWork += ( uint64_t ) ulEDFSpeed;
+            }
+        #endif
+
+        /* E.C. : close the utilization window.  The idle task only runs when
+         * nothing else is ready, so the CPU load is whatever it did not use. */
+        #if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_UTILIZATION == 1 ) )
+            {
+                if( ( TickType_t ) ( xConstTickCount - xEDFWindowStartTick ) >= configEDF_UTILIZATION_WINDOW )
+                {
+                    uint32_t ulIdleTime;
+
+                    /* Charge the running task up to the window boundary so
+                     * every window only holds time spent inside it. */
+                    prvEDFAccountRunTime();
+
+                    ulEDFLastWindowLength = ulEDFSwitchedInTime - ulEDFWindowStartTime;
+                    ulEDFWindowStartTime = ulEDFSwitchedInTime;
+                    xEDFWindowStartTick = xConstTickCount;
+                    ulEDFWindowNumber++;
+
+                    ulIdleTime = prvEDFLastWindowRunTime( xIdleTaskHandle );
+
+                    if( ulIdleTime < ulEDFLastWindowLength )
+                    {
+                        ulEDFCpuLoad = 1000UL - prvEDFPermille( ulIdleTime, ulEDFLastWindowLength );
+                    }
+                    else
+                    {
+                        ulEDFCpuLoad = 0UL;
+                    }
+
+                    traceEDF_UTILIZATION_WINDOW( ulEDFCpuLoad );
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+        #endif
+
         /* See if this tick has made a timeout expire.  Tasks are stored in
          * the  queue in the order of their wake time - meaning once one task
          * has been found whose block time has not expired there is no need to
@@ -2968,8 +5650,9 @@ BaseType_t xTaskIncrementTick( void )
                     }
 										/*E.C. calculate the new task deadline*/
 										///////////////////******************************/////////////////////////////
-										#if (configUSE_EDF_SCHEDULER == 1)
-														listSET_LIST_ITEM_VALUE( &( ( pxTCB )->xStateListItem ), ( pxTCB)->xTaskPeriod + xTaskGetTickCount() );
+										#if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configEDF_RELEASE_DEADLINE == 1 ) )
+														taskEDF_SET_DEADLINE( pxTCB, xTaskGetTickCount() );
+														taskEDF_RECORD_JOB_RELEASE( pxTCB );
 										#endif
 					
                     /* Place the unblocked task into the appropriate ready
@@ -2997,8 +5680,17 @@ BaseType_t xTaskIncrementTick( void )
 													//////////////////////////////////////****************************//////////////////////////
 													/*E.C. Context Switching will always take place */ 
 										                    
-													#elif (configUSE_EDF_SCHEDULER == 1)
-                            if( listGET_LIST_ITEM_VALUE( &( ( pxCurrentTCB )->xStateListItem ) ) >= listGET_LIST_ITEM_VALUE( &( ( pxTCB )->xStateListItem ) )  )
+													#elif ( configUSE_EDF_BAND == 1 )
+                            if( taskEDF_PREEMPTS( pxTCB ) && taskEDF_ABOVE_THRESHOLD( pxTCB ) )
+                            {
+                                xSwitchRequired = pdTRUE;
+                            }
+                            else
+                            {
+                                mtCOVERAGE_TEST_MARKER();
+                            }
+													#elif ( configEDF_RELEASE_PREEMPTION == 1 )
+                            if( taskEDF_PREEMPTS( pxTCB ) && taskEDF_ABOVE_THRESHOLD( pxTCB ) )
                             {
                                 xSwitchRequired = pdTRUE;
                             }
@@ -3011,6 +5703,27 @@ BaseType_t xTaskIncrementTick( void )
                     #endif /* configUSE_PREEMPTION */
                 }
             }
+
+            /* E.C. : in HI mode no LO job is released, and the jobs released
+             * by this tick may not all fit. */
+            #if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_MIXED_CRITICALITY == 1 ) )
+                {
+                    if( xEDFCriticalityMode == edfCRITICALITY_HI )
+                    {
+                        prvEDFShedLowCriticality();
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+            #endif
+
+            #if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_OVERLOAD == 1 ) )
+                {
+                    prvEDFShedOverload();
+                }
+            #endif
         }
 
         /* Tasks of equal priority to the currently running task will share
@@ -3018,7 +5731,14 @@ BaseType_t xTaskIncrementTick( void )
          * writer has not explicitly turned time slicing off. */
         #if ( ( configUSE_PREEMPTION == 1 ) && ( configUSE_TIME_SLICING == 1 ) )
             {
+                /* E.C. : the tasks of an EDF band do not share the time,
+                 * the earliest deadline keeps the processor. */
+                #if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_BAND == 1 ) )
+                if( ( listCURRENT_LIST_LENGTH( &( pxReadyTasksLists[ pxCurrentTCB->uxPriority ] ) ) > ( UBaseType_t ) 1 ) &&
+                    ( pxCurrentTCB->uxPriority != ( UBaseType_t ) configEDF_BAND_PRIORITY ) )
+                #else
                 if( listCURRENT_LIST_LENGTH( &( pxReadyTasksLists[ pxCurrentTCB->uxPriority ] ) ) > ( UBaseType_t ) 1 )
+                #endif
                 {
                     xSwitchRequired = pdTRUE;
                 }
@@ -3029,6 +5749,63 @@ BaseType_t xTaskIncrementTick( void )
             }
         #endif /* ( ( configUSE_PREEMPTION == 1 ) && ( configUSE_TIME_SLICING == 1 ) ) */
 
+        /* E.C. : the jobs released this tick may need a higher speed, those
+         * completed since the last one may allow a lower. */
+        #if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_DVS == 1 ) )
+            {
+                if( xEDFSpeedStale != pdFALSE )
+                {
+                    prvEDFDVSUpdateSpeed();
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+        #endif
+
+        /* E.C. : give the ready soft jobs the slack there is. */
+        #if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_SLACK_STEALING == 1 ) )
+            {
+                if( prvEDFStealSlack() != pdFALSE )
+                {
+                    xSwitchRequired = pdTRUE;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+        #endif
+
+        /* E.C. : a job inside its non-preemptive region keeps the processor,
+         * the preemption is taken on the tick that ends the region. */
+        #if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_LIMITED_PREEMPTION == 1 ) )
+            {
+                xEDFRegionExecuted++;
+
+                if( xSwitchRequired != pdFALSE )
+                {
+                    if( prvEDFDeferPreemption() != pdFALSE )
+                    {
+                        xSwitchRequired = pdFALSE;
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+                else if( ( xEDFPreemptionDeferred != pdFALSE ) && !taskEDF_IN_NON_PREEMPTIVE_REGION() )
+                {
+                    xSwitchRequired = pdTRUE;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+        #endif
+
         #if ( configUSE_TICK_HOOK == 1 )
             {
                 /* Guard against the tick hook being called when the pended tick
@@ -3227,6 +6004,12 @@ void vTaskSwitchContext( void )
             }
         #endif /* configGENERATE_RUN_TIME_STATS */
 
+        #if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_UTILIZATION == 1 ) )
+            {
+                prvEDFAccountRunTime();
+            }
+        #endif
+
         /* Check for stack overflow, if configured. */
         taskCHECK_FOR_STACK_OVERFLOW();
 
@@ -3245,9 +6028,54 @@ void vTaskSwitchContext( void )
 		{
 			taskSELECT_HIGHEST_PRIORITY_TASK(); 
 		}
+		#elif ( configUSE_EDF_BAND == 0 )
+		{
+			#if ( configUSE_EDF_PREEMPTION_THRESHOLD == 1 )
+				pxCurrentTCB = prvEDFSelectAboveCeiling();
+			#else
+				pxCurrentTCB = (TCB_t * ) listGET_OWNER_OF_HEAD_ENTRY( &(xReadyTasksListEDF ) );
+			#endif
+			taskEDF_RECORD_JOB_START();
+			taskEDF_HOLD_THRESHOLD();
+		}
 		#else
 		{
-			pxCurrentTCB = (TCB_t * ) listGET_OWNER_OF_HEAD_ENTRY( &(xReadyTasksListEDF ) );
+			/* E.C. : find the highest ready priority as usual, but inside the
+			 * EDF band take the earliest deadline instead of the next task. */
+			taskSELECT_HIGHEST_PRIORITY_TASK();
+
+			if( pxCurrentTCB->uxPriority == ( UBaseType_t ) configEDF_BAND_PRIORITY )
+			{
+				#if ( configUSE_EDF_PREEMPTION_THRESHOLD == 1 )
+					pxCurrentTCB = prvEDFSelectAboveCeiling();
+				#else
+					pxCurrentTCB = ( TCB_t * ) listGET_OWNER_OF_HEAD_ENTRY( &( xReadyTasksListEDF ) );
+				#endif
+				taskEDF_HOLD_THRESHOLD();
+			}
+
+			taskEDF_RECORD_JOB_START();
+		}
+		#endif
+
+		/* E.C. : a job that has been dispatched can no longer be shed. */
+		#if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_OVERLOAD == 1 ) )
+		{
+			pxCurrentTCB->pxTaskWakeTime = NULL;
+		}
+		#endif
+
+		/* E.C. : a held back preemption has now been taken, and a task
+		 * switched in starts a new non-preemptive region. */
+		#if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_LIMITED_PREEMPTION == 1 ) )
+		{
+			xEDFPreemptionDeferred = pdFALSE;
+
+			if( pxCurrentTCB != pxEDFRegionTCB )
+			{
+				pxEDFRegionTCB = pxCurrentTCB;
+				xEDFRegionExecuted = ( TickType_t ) 0U;
+			}
 		}
 		#endif
         			traceTASK_SWITCHED_IN();			
@@ -3618,6 +6446,10 @@ void vTaskMissedYield( void )
  */
 static portTASK_FUNCTION( prvIdleTask, pvParameters )
 {
+    #if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configEDF_IDLE_DEADLINE_REFRESH == 1 ) )
+        TickType_t xIdleRefreshTick = xTickCount - ( TickType_t ) 1; /*< E.C. : tick of the last deadline refresh. */
+    #endif
+
     /* Stop warnings. */
     ( void ) pvParameters;
     /** THIS IS THE RTOS IDLE TASK - WHICH IS CREATED AUTOMATICALLY WHEN THE
@@ -3634,14 +6466,69 @@ static portTASK_FUNCTION( prvIdleTask, pvParameters )
          * is responsible for freeing the deleted task's TCB and stack. */
         
 		//////////////////////*********************************/////////////////////////////	
-			#if( configUSE_EDF_SCHEDULER == 1)
+			#if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configEDF_IDLE_DEADLINE_REFRESH == 1 ) )
 					{
-			/*E.C. Modify the idle task to keep it always the farest deadline*/
-					listSET_LIST_ITEM_VALUE(&(( pxCurrentTCB )->xStateListItem ), ( pxCurrentTCB )->xTaskPeriod + xTaskGetTickCount() );
-					listINSERT_END(&(xReadyTasksListEDF),&(( pxCurrentTCB )->xStateListItem));
+			/*E.C. Modify the idle task to keep it always the farest deadline.  The
+			 * idle task is already in the ready list, so it is moved to its new
+			 * place rather than inserted a second time, and only once per tick. */
+					if( xIdleRefreshTick != xTickCount )
+					{
+						vTaskSuspendAll();
+						{
+							xIdleRefreshTick = xTickCount;
+							( void ) uxListRemove( &( pxCurrentTCB->xStateListItem ) );
+							taskEDF_SET_DEADLINE( pxCurrentTCB, xIdleRefreshTick );
+							prvAddTaskToReadyList( pxCurrentTCB );
+						}
+						( void ) xTaskResumeAll();
+					}
 					}
 		#endif
 					
+		/* E.C. : with no job left but the idle task, HI mode is over. */
+		#if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_MIXED_CRITICALITY == 1 ) )
+			{
+				if( xEDFCriticalityMode != edfCRITICALITY_LO )
+				{
+					taskENTER_CRITICAL();
+					{
+						if( listCURRENT_LIST_LENGTH( &( xReadyTasksListEDF ) ) <= ( UBaseType_t ) 1 )
+						{
+							xEDFCriticalityMode = edfCRITICALITY_LO;
+							traceEDF_CRITICALITY_MODE( xEDFCriticalityMode );
+						}
+					}
+					taskEXIT_CRITICAL();
+				}
+			}
+		#endif
+
+		/* E.C. : with no job left but the idle task, the old mode is over. */
+		#if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_MODES == 1 ) )
+			{
+				if( pxEDFModeChange != NULL )
+				{
+					BaseType_t xApplied = pdFALSE;
+
+					vTaskSuspendAll();
+					{
+						if( listCURRENT_LIST_LENGTH( &( xReadyTasksListEDF ) ) <= ( UBaseType_t ) 1 )
+						{
+							prvEDFApplyModeChange( pxEDFModeChange );
+							pxEDFModeChange = NULL;
+							xApplied = pdTRUE;
+						}
+					}
+
+					/* The tasks started have earlier deadlines than the idle task. */
+					if( ( xTaskResumeAll() == pdFALSE ) && ( xApplied != pdFALSE ) )
+					{
+						taskYIELD();
+					}
+				}
+			}
+		#endif
+
 					prvCheckTasksWaitingTermination();
         #if ( configUSE_PREEMPTION == 0 )
             {
@@ -3864,7 +6751,7 @@ static void prvInitialiseTaskLists( void )
 		
 	//////////////////////////////********************************************/////////////////////////////////
 		/* E.C. */
-	#if ( configUSE_EDF_SCHEDULER == 1 )
+	#if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_BAND == 0 ) )
 	{
 		vListInitialise( &xReadyTasksListEDF );
 	}
@@ -3949,6 +6836,11 @@ static void prvCheckTasksWaitingTermination( void )
             {
                 pxTaskStatus->ulRunTimeCounter = pxTCB->ulRunTimeCounter;
             }
+        #elif ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_UTILIZATION == 1 ) )
+            {
+                /* E.C. : truncated to the width of configRUN_TIME_COUNTER_TYPE. */
+                pxTaskStatus->ulRunTimeCounter = ( configRUN_TIME_COUNTER_TYPE ) pxTCB->ullRunTime;
+            }
         #else
             {
                 pxTaskStatus->ulRunTimeCounter = ( configRUN_TIME_COUNTER_TYPE ) 0;
@@ -4637,6 +7529,10 @@ static void prvResetNextTaskUnblockTime( void )
         UBaseType_t uxArraySize, x;
         char cStatus;
 
+        #if ( configUSE_EDF_SCHEDULER == 1 )
+            EDFTaskStatus_t * pxEDFStatusArray;
+        #endif
+
         /*
          * PLEASE NOTE:
          *
@@ -4648,7 +7544,9 @@ static void prvResetNextTaskUnblockTime( void )
          * uxTaskGetSystemState() output into a human readable table that
          * displays task: names, states, priority, stack usage and task number.
          * Stack usage specified as the number of unused StackType_t words stack can hold
-         * on top of stack - not the number of bytes.
+         * on top of stack - not the number of bytes.  E.C. : under EDF the
+         * period, the absolute deadline and the number of deadline misses of
+         * each task are appended, taken from the same snapshot.
          *
          * vTaskList() has a dependency on the sprintf() C library function that
          * might bloat the code size, use a lot of stack, and provide different
@@ -4676,10 +7574,31 @@ static void prvResetNextTaskUnblockTime( void )
          * equate to NULL. */
         pxTaskStatusArray = pvPortMalloc( uxCurrentNumberOfTasks * sizeof( TaskStatus_t ) ); /*lint !e9079 All values returned by pvPortMalloc() have at least the alignment required by the MCU's stack and this allocation allocates a struct that has the alignment requirements of a pointer. */
 
+        #if ( configUSE_EDF_SCHEDULER == 1 )
+            {
+                /* Only allocated once the first array is, so neither is
+                 * left behind when the other cannot be had. */
+                if( pxTaskStatusArray != NULL )
+                {
+                    pxEDFStatusArray = pvPortMalloc( uxArraySize * sizeof( EDFTaskStatus_t ) );
+
+                    if( pxEDFStatusArray == NULL )
+                    {
+                        vPortFree( pxTaskStatusArray );
+                        pxTaskStatusArray = NULL;
+                    }
+                }
+            }
+        #endif
+
         if( pxTaskStatusArray != NULL )
         {
             /* Generate the (binary) data. */
-            uxArraySize = uxTaskGetSystemState( pxTaskStatusArray, uxArraySize, NULL );
+            #if ( configUSE_EDF_SCHEDULER == 1 )
+                uxArraySize = uxTaskGetSystemStateEDF( pxTaskStatusArray, pxEDFStatusArray, uxArraySize, NULL );
+            #else
+                uxArraySize = uxTaskGetSystemState( pxTaskStatusArray, uxArraySize, NULL );
+            #endif
 
             /* Create a human readable table from the binary data. */
             for( x = 0; x < uxArraySize; x++ )
@@ -4718,13 +7637,21 @@ static void prvResetNextTaskUnblockTime( void )
                 pcWriteBuffer = prvWriteNameToBuffer( pcWriteBuffer, pxTaskStatusArray[ x ].pcTaskName );
 
                 /* Write the rest of the string. */
-                sprintf( pcWriteBuffer, "\t%c\t%u\t%u\t%u\r\n", cStatus, ( unsigned int ) pxTaskStatusArray[ x ].uxCurrentPriority, ( unsigned int ) pxTaskStatusArray[ x ].usStackHighWaterMark, ( unsigned int ) pxTaskStatusArray[ x ].xTaskNumber ); /*lint !e586 sprintf() allowed as this is compiled with many compilers and this is a utility function only - not part of the core kernel implementation. */
+                #if ( configUSE_EDF_SCHEDULER == 1 )
+                    sprintf( pcWriteBuffer, "\t%c\t%u\t%u\t%u\t%u\t%u\t%u\r\n", cStatus, ( unsigned int ) pxTaskStatusArray[ x ].uxCurrentPriority, ( unsigned int ) pxTaskStatusArray[ x ].usStackHighWaterMark, ( unsigned int ) pxTaskStatusArray[ x ].xTaskNumber, ( unsigned int ) pxEDFStatusArray[ x ].xPeriod, ( unsigned int ) pxEDFStatusArray[ x ].xAbsoluteDeadline, ( unsigned int ) pxEDFStatusArray[ x ].ulDeadlineMisses ); /*lint !e586 sprintf() allowed as this is compiled with many compilers and this is a utility function only - not part of the core kernel implementation. */
+                #else
+                    sprintf( pcWriteBuffer, "\t%c\t%u\t%u\t%u\r\n", cStatus, ( unsigned int ) pxTaskStatusArray[ x ].uxCurrentPriority, ( unsigned int ) pxTaskStatusArray[ x ].usStackHighWaterMark, ( unsigned int ) pxTaskStatusArray[ x ].xTaskNumber ); /*lint !e586 sprintf() allowed as this is compiled with many compilers and this is a utility function only - not part of the core kernel implementation. */
+                #endif
                 pcWriteBuffer += strlen( pcWriteBuffer );                                                                                                                                                                                                /*lint !e9016 Pointer arithmetic ok on char pointers especially as in this case where it best denotes the intent of the code. */
             }
 
             /* Free the array again.  NOTE!  If configSUPPORT_DYNAMIC_ALLOCATION
              * is 0 then vPortFree() will be #defined to nothing. */
             vPortFree( pxTaskStatusArray );
+
+            #if ( configUSE_EDF_SCHEDULER == 1 )
+                vPortFree( pxEDFStatusArray );
+            #endif
         }
         else
         {